@@ -18,6 +18,7 @@
 
 #include "eddl/net/net.h"
 #include "eddl/net/netloss.h"
+#include "eddl/net/prefetcher.h"
 #include "eddl/initializers/initializer.h"
 #include "eddl/regularizers/regularizer.h"
 #include "eddl/losses/loss.h"
@@ -48,6 +49,7 @@ typedef Regularizer* regularizer;
 typedef CompServ* compserv;
 typedef NetLoss * loss;
 typedef NetLoss * metric;
+typedef Prefetcher * dataloader;
 
     ///////////////////////////////////////
     //  MODEL METHODS
@@ -81,6 +83,54 @@ typedef NetLoss * metric;
     */
     void build(model net, optimizer o, const vector<string> &lo, const vector<string> &me, CompServ *cs=nullptr, bool init_weights=true);
 
+    /**
+      *  @brief Prepares a built model for inference only (CPU).
+      *
+      *  @details
+      *   BatchNorm layers are folded into the preceding Conv/Dense weights and bias, and ReLU/Sigmoid/Tanh activations are applied by the preceding Conv/Dense layer. The removed layers are deleted, so they must not be used afterwards. The model can not be trained, saved or exported to ONNX anymore.
+      *
+      *  @param net  Model (already built and with its weights loaded)
+      *  @return     (void)
+    */
+    void optimize_inference(model net);
+
+    /**
+      *  @brief Quantizes the Dense and Conv layers of a built model to int8 (or 16-bit floats) for inference (CPU).
+      *
+      *  @details
+      *   Weights are quantized per output channel. The range of the input of each layer is taken from a forward pass with the calibration data, values out of that range are clamped. Products are accumulated in int32 and turned back to float with the bias and fused activation, so the rest of the net is unchanged. It can be used after optimize_inference. The model can not be trained, saved or exported to ONNX anymore.
+      *   With dtype "bfloat16" or "float16" only the weights are stored in 16 bits, inputs stay in float and products are accumulated in float, so no calibration data is needed.
+      *
+      *  @param net  Model (already built and with its weights loaded)
+      *  @param calibration  One batch of representative samples per input of the net (int8 only)
+      *  @param dtype  Storage type of the weights: int8, bfloat16 or float16
+      *  @param keep_float  Keep the float32 weights of the quantized layers. By default they are freed, and BatchNorm layers folded later (optimize_inference) scale the quantized weights
+      *  @return     (void)
+    */
+    void quantize(model net, vector<Tensor *> calibration, const string& dtype="int8", bool keep_float=false);
+
+    /**
+      *  @brief Makes the Concat layers of a built model work in place (CPU).
+      *
+      *  @details
+      *   The parents of a Concat layer write their outputs directly into the output of the Concat, and with the full memory level their deltas are slices of its delta, so the Concat does no copies in either direction. With batch size 1 (or all the dimensions before the axis 1) any parent can do it. With a larger batch the slices of a channel concat (axis 1 of images) are strided: only the Conv layers that feed nothing but the Concat write there, and the other parents are copied as usual. This is checked again whenever the batch size changes. Parents whose outputs are shared with other layers (e.g. Reshape) or used by another in-place Concat are not changed.
+      *
+      *  @param net  Model (already built)
+      *  @return     (void)
+    */
+    void inplace_concat(model net);
+
+    /**
+      *  @brief Shares the memory of the outputs of the hidden layers of a built model for inference (CPU).
+      *
+      *  @details
+      *   The forward order gives the lifetime of every output, from the layer that writes it to the last layer that reads it. Outputs that are not alive at the same time get the same place of one arena, and elementwise layers (activations other than softmax, Dropout) write over their input when nobody reads it later. The plan is done again whenever the batch size changes. Inputs and outputs of the net keep their own memory, but the outputs of the hidden layers (e.g. getOutput) are not valid after the forward. Like optimize_inference, it makes the model inference-only: the deltas are freed, and it can not be trained, saved or exported to ONNX anymore. With verbosity level 1 the memory of the activations with and without the plan is shown.
+      *
+      *  @param net  Model (already built)
+      *  @return     (void)
+    */
+    void plan_memory(model net);
+
     // Computing services
     /**
       *  @brief Assign model operations to the GPU.
@@ -274,9 +324,10 @@ typedef NetLoss * metric;
       *
       *  @param m  Model
       *  @param fname  Where the model weights will be saved
+      *  @param dtype  Storage type of the weights: float32, bfloat16 or float16 (half the size, loaded back as float32)
       *  @return     (void) Save the weights
     */
-    void save(model m, const string& fname, string format="bin");
+    void save(model m, const string& fname, string format="bin", const string& dtype="float32");
 
     // Optimizer
     /**
@@ -309,18 +360,34 @@ typedef NetLoss * metric;
     /**
       *  @brief Adam optimizer.
       *  @details Default parameters follow those provided in the original paper (See section).
+      *   weight_decay is not applied, as in earlier versions; see adamw for the decoupled weight decay.
       *  @see   https://arxiv.org/abs/1412.6980v8
       *
       *  @param lr  Learning rate
       *  @param beta_1  Coefficients used for computing running averages of gradient and its square
       *  @param beta_2  Coefficients used for computing running averages of gradient and its square
       *  @param epsilon   Term added to the denominator to improve numerical stability
-      *  @param weight_decay   Weight decay (L2 penalty)
+      *  @param weight_decay   Weight decay (not applied, see adamw)
       *  @param amsgrad   Whether to apply the AMSGrad variant of this algorithm from the paper "On the Convergence of Adam and Beyond".
       *  @return     Adam optimizer
     */
     optimizer adam(float lr=0.01, float beta_1=0.9, float beta_2=0.999, float epsilon=0.000001, float weight_decay=0,bool amsgrad=false); //Todo: Implement
 
+    /**
+      *  @brief AdamW optimizer.
+      *  @details Adam with decoupled weight decay: the decay is applied directly to the parameters instead of being added to the gradients.
+      *  @see   https://arxiv.org/abs/1711.05101
+      *
+      *  @param lr  Learning rate
+      *  @param beta_1  Coefficients used for computing running averages of gradient and its square
+      *  @param beta_2  Coefficients used for computing running averages of gradient and its square
+      *  @param epsilon   Term added to the denominator to improve numerical stability
+      *  @param weight_decay   Decoupled weight decay
+      *  @param amsgrad   Whether to apply the AMSGrad variant of this algorithm from the paper "On the Convergence of Adam and Beyond".
+      *  @return     AdamW optimizer
+    */
+    optimizer adamw(float lr=0.001, float beta_1=0.9, float beta_2=0.999, float epsilon=0.000001, float weight_decay=0.01, bool amsgrad=false);
+
 
     /**
       *  @brief Adagrad optimizer.
@@ -442,6 +509,36 @@ typedef NetLoss * metric;
     void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out);
     void eval_batch(model net, vector<Tensor *> in, vector<Tensor *> out);
 
+    /**
+      *  @brief Creates a background batch loader. Batches are gathered (and transformed) by a worker thread while the previous one is being used.
+      *
+      *  @param in  Input data (features)
+      *  @param out  Output data (labels)
+      *  @param batch_size  Batch size
+      *  @param shuffle  Visit the samples in a new random order every epoch
+      *  @param depth  Number of batches prepared in advance
+      *  @return     The loader (delete it when done)
+    */
+    dataloader prefetch(const vector<Tensor *> &in, const vector<Tensor *> &out, int batch_size, bool shuffle=true, int depth=2);
+    dataloader prefetch(const vector<Dataset *> &in, const vector<Dataset *> &out, int batch_size, bool shuffle=true, int depth=2);
+    /**
+      *  @brief Gets the next batch of a loader. Returns false at the end of each epoch, the following call starts a new one.
+      *
+      *  @param l  Loader
+      *  @param in  Input batch (valid until the next call)
+      *  @param out  Output batch (valid until the next call)
+      *  @return     Whether a batch was returned
+    */
+    bool next_batch(dataloader l, vector<Tensor *> &in, vector<Tensor *> &out);
+    /**
+      *  @brief Opens bin files as one dataset (concatenated along the samples) without reading them. The files are memory mapped, pages are read on first access.
+      *
+      *  @param filenames  Shards, in order
+      *  @param sequential  Access hint: sequential (read-ahead) or random
+      *  @return     The dataset (delete it when done)
+    */
+    Dataset *open_dataset(const vector<string> &filenames, bool sequential=true);
+
     // Finest methods
     /**
       *  @brief Set model mode.
@@ -502,6 +599,50 @@ typedef NetLoss * metric;
     */
     void clamp(model m,float min,float max);
 
+    // profiling
+    /**
+      *  @brief Starts recording the time spent in the CPU kernels and in each layer (forward/backward).
+      *
+      *  @param trace  Also keep every event to export a Chrome trace (more memory)
+      *  @return     (void)
+    */
+    void enable_profiling(bool trace=false);
+    /**
+      *  @brief Stops recording. The collected data is kept until reset_profiling is called.
+      *
+      *  @return     (void)
+    */
+    void disable_profiling();
+    /**
+      *  @brief Discards the collected profiling data.
+      *
+      *  @return     (void)
+    */
+    void reset_profiling();
+    /**
+      *  @brief Prints the time per CPU kernel and the per-layer summary table.
+      *
+      *  @return     (void)
+    */
+    void show_profile();
+    /**
+      *  @brief Saves the recorded events in Chrome trace format (chrome://tracing, Perfetto).
+      *
+      *  @param fname  Output filename (.json)
+      *  @return     (void)
+    */
+    void save_profile_trace(const string& fname);
+
+    // random
+    /**
+      *  @brief Seeds the random generator used on CPU by tensors, initializers and layers (dropout, noise, DA...).
+      *  The same seed gives the same numbers regardless of the number of threads.
+      *
+      *  @param seed  Seed
+      *  @return     (void)
+    */
+    void set_seed(unsigned long seed);
+
     // loss and metrics methods
     float compute_loss(loss L);
     float compute_metric(loss L);
@@ -716,6 +857,23 @@ typedef NetLoss * metric;
                const vector<int> &strides = {1, 1}, string padding = "same", bool use_bias = true,
                int groups = 1, const vector<int> &dilation_rate = {1, 1}, string name = "");
 
+    /**
+      *  @brief 2D Depthwise convolution layer. Each input channel is convolved with its own depth_multiplier filters (a Conv with as many groups as input channels).
+      *
+      *  @param parent  Parent layer
+      *  @param kernel_size  Vector of 2 integers, specifying the height and width of the 2D convolution window.
+      *  @param strides  Vector of 2 integers, specifying the strides of the convolution along the height and width
+      *  @param padding  One of "none", "valid" or "same"
+      *  @param use_bias  Boolean, whether the layer uses a bias vector.
+      *  @param depth_multiplier  Number of output channels for each input channel
+      *  @param dilation_rate  Vector of 2 integers, specifying the dilation rate to use for dilated convolution
+      *  @param name  A name for the operation
+      *  @return     Convolution layer
+    */
+    layer DepthwiseConv2D(layer parent, const vector<int> &kernel_size,
+                          const vector<int> &strides = {1, 1}, string padding = "same", bool use_bias = true,
+                          int depth_multiplier = 1, const vector<int> &dilation_rate = {1, 1}, string name = "");
+
 
      /**
     *  @brief 1D Convolution layer.
@@ -824,7 +982,7 @@ typedef NetLoss * metric;
     layer ConvT(layer parent, int filters, const vector<int> &kernel_size,
                 const vector<int> &output_padding, string padding = "same",
                 const vector<int> &dilation_rate = {1, 1},
-                const vector<int> &strides = {1, 1}, bool use_bias = true, string name = ""); //Todo: Implement
+                const vector<int> &strides = {1, 1}, bool use_bias = true, string name = "");
 
     /**
       *  @brief Turns positive integers (indexes) into dense vectors of fixed size. eg. [[4], [20]] -> [[0.25, 0.1], [0.6, -0.2]]
@@ -1123,6 +1281,25 @@ typedef NetLoss * metric;
       *  @return     Output of random vertical flip transformation
     */
     layer RandomVerticalFlip(layer parent, string name= "");
+    /**
+      *  @brief Random crop-scale, flip, rotation, scale, shift and cutout in a single pass. The transforms of each sample are merged into one affine map, so the image is resampled only once, and the cutout is filled while it is written.
+      *
+      *  @param parent  Parent layer
+      *  @param rotation  Range of the rotation angle in degrees (as in RandomRotation)
+      *  @param scale  Range of the scale factor
+      *  @param shift_x  Range of the horizontal translation (fraction of the width)
+      *  @param shift_y  Range of the vertical translation (fraction of the height)
+      *  @param flip_axis  Axis flipped with probability 0.5 (as in RandomFlip), -1 for none
+      *  @param crop_scale  Range of the size of a random crop (fraction of the image), scaled back to the full size (as in RandomCropScale)
+      *  @param cutout_x  Range of the width of a random area filled with constant (fraction of the width, as in RandomCutout)
+      *  @param cutout_y  Range of the height of that area (fraction of the height)
+      *  @param interpolation  One of "bilinear", "nearest"
+      *  @param da_mode  One of "constant", "nearest", "original"
+      *  @param constant  Fill value for area outside the transformed image, it is used for all channels respectively.
+      *  @param name  A name for the operation
+      *  @return     Output of affine transformation
+    */
+    layer RandomAffine(layer parent, vector<float> rotation= {0.0f, 0.0f}, vector<float> scale= {1.0f, 1.0f}, vector<float> shift_x= {0.0f, 0.0f}, vector<float> shift_y= {0.0f, 0.0f}, int flip_axis= -1, vector<float> crop_scale= {1.0f, 1.0f}, vector<float> cutout_x= {0.0f, 0.0f}, vector<float> cutout_y= {0.0f, 0.0f}, string interpolation= "bilinear", string da_mode= "constant", float constant= 0.0f, string name= "");
 
     // Merge Layers
     /**
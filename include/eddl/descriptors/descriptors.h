@@ -23,6 +23,52 @@
 
 using namespace std;
 
+// CPU convolution algorithms
+#define CONV_ALGO_IM2COL 0      // im2col lowering + GEMM (any shape)
+#define CONV_ALGO_DIRECT_1X1 1  // 1x1, stride 1, no padding: GEMM on the input itself
+#define CONV_ALGO_WINOGRAD_2X2 2  // Winograd F(2x2,3x3), stride 1
+#define CONV_ALGO_WINOGRAD_4X4 3  // Winograd F(4x4,3x3), stride 1
+#define CONV_ALGO_DEPTHWISE 4     // direct kernel, one input channel per group
+
+// Output pixels lowered at once per thread with mem_level 2 (low_mem)
+#define CONV_TILE_ROWS 256
+
+// Activations fused into the output of a layer (inference only)
+#define FUSED_ACT_NONE 0
+#define FUSED_ACT_RELU 1
+#define FUSED_ACT_SIGMOID 2
+#define FUSED_ACT_TANH 3
+
+// Post-training int8 quantization of the weights of a Dense/Conv layer
+// (inference only, see Net::quantize). Weights are symmetric per output
+// channel, inputs are asymmetric uint8 with the range found in calibration.
+#define QUANT_BLOCK 4  // output channels computed together, see cpu_quant.cpp
+
+class QuantDescriptor {
+public:
+    int nout;  // output channels
+    int nin;   // inputs of each output channel
+    int npad;  // nout rounded up to QUANT_BLOCK
+
+    int dtype;  // DTYPE_INT8, or DTYPE_BFLOAT16/DTYPE_FLOAT16 (float inputs, no calibration)
+
+    int8_t *W;  // {npad,nin}, padding channels are zero
+    float *wscale;  // {nout}
+    uint16_t *H;  // {npad,nin}, 16-bit weights instead of W and wscale
+
+    float in_min, in_max;  // calibrated range of the input
+    float in_scale;
+    int in_zero;
+
+    QuantDescriptor(Tensor *K, bool channels_last, int dtype=DTYPE_INT8);
+    ~QuantDescriptor();
+
+    void calibrate(Tensor *A);
+    void set_range();
+    void scale(const vector<float> &s);
+    size_t bytes();
+};
+
 class MapReduceDescriptor {
 public:
     int *ind;
@@ -40,7 +86,15 @@ public:
     int m;
     int red_size;
 
-    vector<vector<int>> index;
+    vector<vector<int>> index; // GPU/FPGA
+
+    // CPU: dims of the input merged into kept/reduced blocks (see build_plan)
+    vector<int> kshape, kstride; // kept dims, row-major order of the output
+    vector<int> roff; // offsets of the reduced positions, but the inner dim
+    int inner; // size of the innermost (contiguous) dim
+    bool inner_red; // the innermost dim is reduced
+    int groups, group_size; // outputs, elements reduced into each output
+
     Tensor *I; // input
     Tensor *O; // output
     Tensor *D; // delta
@@ -58,9 +112,25 @@ public:
 
     void resize(int b);
     void build_index();
+    void build_plan();
 
 };
 
+class ConvolDescriptor;
+
+// Lowering (im2col) buffer of the CPU convolutions, shared by all the layers
+// of a net: it grows to the largest one (see ConvolDescriptor::workspace)
+class ConvolWorkspace {
+public:
+    float *ptr=nullptr;
+    size_t size=0;
+    ConvolDescriptor *owner=nullptr; // its whole lowered batch is in ptr (mem_level 0)
+
+    ~ConvolWorkspace();
+
+    float *reserve(size_t n);
+};
+
 class ConvolDescriptor {
 public:
     vector<int> ksize;
@@ -68,8 +138,10 @@ public:
     vector<int> pad; // {rows-top, rows-bottom, cols-left, cols-right}
     string padding; // valid/none, same/zeros, custom
 
-    int nk, kr, kc, kz;
+    int nk, kr, kc, kz; // kz: input channels of each group
     int sr, sc;
+    int dr=1, dc=1; // dilation rate (rows, cols)
+    int groups=1; // input and output channels are split in groups
     int ir, ic, iz;
     int r, c, z;
     int padrt,padrb;
@@ -90,12 +162,17 @@ public:
     Tensor *O= nullptr; // Outputmap
 
     // CPU implementation
-    float *ptrI;
+    int cpu_algo=CONV_ALGO_IM2COL; // see CONV_ALGO_*
+    ConvolWorkspace *ws=nullptr; // lowering buffer, shared with the net (see set_workspace)
+    bool own_ws=false;
+    float *ptrI=nullptr; // im2col buffer (FPGA)
+    int fused_act=FUSED_ACT_NONE; // applied with the bias, see FUSED_ACT_*
+    QuantDescriptor *qd=nullptr; // int8 weights, see Net::quantize
     Eigen::MatrixXf matI; // input
-    Eigen::MatrixXf matK; // kernels
+    Eigen::Map<Eigen::MatrixXf> matK{nullptr, 0, 0}; // kernels (maps K, see build)
     Eigen::MatrixXf matO; // output
     Eigen::MatrixXf matD; // Delta
-    Eigen::MatrixXf matgK; // gradient kernels
+    Eigen::Map<Eigen::MatrixXf> matgK{nullptr, 0, 0}; // gradient kernels (maps gK)
 
     // GPU implementation
     Tensor *gpuI; // input
@@ -114,9 +191,11 @@ public:
 
     ConvolDescriptor();
 
-    ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool use_bias, int mem=0);
+    ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool use_bias, int mem=0,
+                     int groups=1, const vector<int> &dilation_rate={1, 1});
 
-    ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem=0);
+    ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem=0,
+                     int groups=1, const vector<int> &dilation_rate={1, 1});
 
     ~ConvolDescriptor();
 
@@ -124,6 +203,13 @@ public:
     void resize(int b);
     void enable_distributed();
 
+    int select_cpu_algo();
+    void set_cpu_algo(int algo);
+
+    void set_workspace(ConvolWorkspace *w, int mem);
+    int lowering_rows();
+    float *workspace();
+
     static int compute_output(const string& padding, int input_size, int kerkel_size, int stride, int dilation_rate=1);
     static int compute_output(vector<int> padding, int input_size, int kerkel_size, int stride, int dilation_rate=1);
     static vector<int> compute_padding(int output_size, int input_size, int kerkel_size, int stride, string padding="same",bool row=false);
@@ -133,7 +219,8 @@ public:
 
 class PoolDescriptor : public ConvolDescriptor {
 public:
-    Tensor *indX, *indY; // indexes
+    Tensor *indX=nullptr, *indY=nullptr; // indexes (GPU/FPGA)
+    int *indI=nullptr; // argmax as a linear index of the input, -1 for padding (CPU)
     int mem_level; // see CS
 
     PoolDescriptor(const vector<int> &ks, const vector<int> &st, const string& p, int mem=0);
@@ -0,0 +1,44 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_CPU_ALLOCATOR_H
+#define EDDL_CPU_ALLOCATOR_H
+
+#include <cstddef>
+
+// Every block returned by the pool starts on a cache line (also valid for AVX-512 loads)
+#define CPU_POOL_ALIGNMENT 64
+
+// Freed blocks above this amount are returned to the system instead of being cached
+#define CPU_POOL_DEFAULT_LIMIT (1UL << 30)
+
+struct CPUPoolStats {
+    unsigned long long in_use;     // Bytes currently handed out
+    unsigned long long cached;     // Bytes kept in the free lists
+    unsigned long long peak;       // Maximum of in_use
+    unsigned long long hits;       // Requests served from the free lists
+    unsigned long long misses;     // Requests that had to go to the system
+    unsigned long long releases;   // Blocks given back to the system
+};
+
+// Size-bucketed, thread-safe caching allocator used for the CPU tensor data
+void *cpu_pool_alloc(size_t bytes);  // nullptr if the system is out of memory
+void cpu_pool_free(void *ptr);       // Pointers not owned by the pool are released with delete[]
+bool cpu_pool_owns(void *ptr);
+
+void cpu_pool_trim(size_t keep_bytes=0);  // Release cached blocks until only "keep_bytes" remain
+void cpu_pool_set_limit(size_t bytes);
+CPUPoolStats cpu_pool_stats();
+void cpu_pool_show_stats();
+
+// Private (copy-on-write) mapping of bytes [offset, offset+bytes) of a file, released
+// by cpu_pool_free. nullptr if it can not be mapped. "sequential" sets the read-ahead hint
+void *cpu_map_file(const char *filename, size_t offset, size_t bytes, bool sequential);
+
+#endif //EDDL_CPU_ALLOCATOR_H
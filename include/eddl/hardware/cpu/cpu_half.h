@@ -0,0 +1,63 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_CPU_HALF_H
+#define EDDL_CPU_HALF_H
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+// 16-bit floats (DTYPE_BFLOAT16, DTYPE_FLOAT16) are stored as their raw bits.
+// Conversions from float round to nearest even, the ones to float are exact.
+
+static inline uint32_t half_bits(float f) { uint32_t u; memcpy(&u, &f, 4); return u; }
+static inline float half_float(uint32_t u) { float f; memcpy(&f, &u, 4); return f; }
+
+static inline uint16_t float_to_bf16(float f) {
+    uint32_t u = half_bits(f);
+    if ((u & 0x7fffffffu) > 0x7f800000u) return (uint16_t)((u >> 16) | 0x40);  // quiet NaN
+    return (uint16_t)((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+
+static inline float bf16_to_float(uint16_t h) {
+    return half_float((uint32_t)h << 16);
+}
+
+static inline uint16_t float_to_fp16(float f) {
+    uint32_t u = half_bits(f);
+    uint16_t sign = (uint16_t)((u >> 16) & 0x8000u);
+    uint32_t a = u & 0x7fffffffu;
+
+    if (a >= 0x47800000u) return sign | ((a > 0x7f800000u) ? 0x7e00 : 0x7c00);  // NaN, inf
+    if (a < 0x38800000u)  // subnormal: adding 0.5 aligns and rounds the mantissa
+        return sign | (uint16_t)(half_bits(half_float(a) + 0.5f) - 0x3f000000u);
+    a += ((a >> 13) & 1u) + 0xfffu - (112u << 23);
+    return sign | (uint16_t)(a >> 13);
+}
+
+// Branchless (masks), so that loops of conversions are vectorized
+static inline float fp16_to_float(uint16_t h) {
+    uint32_t o = (uint32_t)(h & 0x7fffu) << 13;
+    uint32_t e = o & 0x0f800000u;
+    uint32_t sub = 0u - ((e - 1u) >> 31);             // zero, subnormal (e==0)
+    uint32_t inf = 0u - ((e + 0x00800000u) >> 28);    // inf, NaN (e==0x0f800000)
+    o += (112u << 23) + (inf & (112u << 23)) + (sub & (1u << 23));
+
+    // subnormals are renormalized by the float subtraction
+    uint32_t r = half_bits(half_float(o) - half_float(113u << 23));
+    r = (r & sub) | (o & ~sub);
+    return half_float(r | ((uint32_t)(h & 0x8000u) << 16));
+}
+
+// Bulk conversions (parallel)
+void cpu_float_to_half(const float *A, uint16_t *B, size_t n, int dtype);
+void cpu_half_to_float(const uint16_t *A, float *B, size_t n, int dtype);
+
+#endif //EDDL_CPU_HALF_H
@@ -1,6 +1,9 @@
 #ifndef __CPU_PROFILE
 #define __CPU_PROFILE
 
+#include <string>
+#include <atomic>
+
 #define _CPU_ALL               0
 #define _CPU_ANY               1
 #define _CPU_ISFINITE          2
@@ -148,10 +151,45 @@
 #define _CPU_REPEAT_NN             144
 #define _CPU_D_REPEAT_NN           145
 #define _CPU_FLIP                  146
+#define _CPU_ADAM                  147
+#define _CPU_SOFT_CENT             148
+#define _CPU_LSTM_PACK             149
+#define _CPU_LSTM_CELL             150
+#define _CPU_D_LSTM_CELL           151
+#define _CPU_LSTM_GRAD             152
+#define _CPU_BN_FORWARD            153
+#define _CPU_BN_BACKWARD           154
+#define _CPU_BIAS_ACT              155
+#define _CPU_PERMUTE               156
+#define _CPU_AFFINE_RANDOM         157
+#define _CPU_ZERO_ROWS             158
+#define _CPU_SGD_ROWS              159
+#define _CPU_ADAM_ROWS             160
+#define _CPU_RMSPROP_ROWS          161
+#define _CPU_QDENSE                162
+#define _CPU_QCONV2D               163
+#define _CPU_CONV2DT               164
+#define _CPU_CONV2DT_GRAD          165
+#define _CPU_CONV2DT_BACK          166
+
+#define _NUM_CPU_FUNCS       167
+
+// Events kept per thread for the trace (the rest are counted as dropped)
+#define _PROFILE_MAX_EVENTS  4000000
+
+// Disabled by default; when disabled every call returns right away
+extern std::atomic<bool> _profile_enabled;
 
-#define _NUM_CPU_FUNCS       147
-extern int num_instances[_NUM_CPU_FUNCS];
 void _profile(int f_id, int end);
+void _profile_scope_begin(const std::string &name, const std::string &cat);
+void _profile_scope_end();
+
+void _profile_enable(bool trace=false);
+void _profile_disable();
+void _profile_reset();
+void _show_profile();
+void _profile_export_trace(const std::string &fname);
+
 void _profile_add_tensor(long size);
 
 #endif
@@ -23,6 +23,8 @@
 // CPU: Core (static)
 void cpu_transpose(Tensor *A, Tensor *B);
 void cpu_copy(Tensor *A, Tensor *B);
+void cpu_permute(Tensor *A, Tensor *B, const vector<int>& dims, int inc=0);
+bool cpu_permute_(Tensor *A, const vector<int>& dims);
 
 void cpu_fill_(Tensor *A, float v);
 void cpu_fill(Tensor *A, int aini, int aend, Tensor *B, int bini, int bend, int inc);
@@ -71,6 +73,7 @@ void cpu_flip_random(Tensor *A, Tensor *B, int axis);
 void cpu_crop_random(Tensor *A, Tensor *B);
 void cpu_crop_scale_random(Tensor *A, Tensor *B, vector<float> factor, int mode, float constant);
 void cpu_cutout_random(Tensor *A, Tensor *B, vector<float> factor_x, vector<float> factor_y, float constant);
+void cpu_affine_random(Tensor *A, Tensor *B, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, bool bilinear, int mode, float constant);
 
 // CPU: Math (in-place)
 void cpu_abs(Tensor *A, Tensor *B);
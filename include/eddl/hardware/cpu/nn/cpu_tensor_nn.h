@@ -16,6 +16,51 @@
 #include "eddl/tensor/tensor.h"
 #include "eddl/descriptors/descriptors.h"
 
+// exp(x) for x <= 0: 2^n * p(r), |r| <= ln2/2; relative error ~1e-7.
+// Clamp and rounding are done on the bits (no branches nor float->int
+// conversions), so loops using it vectorize
+static inline float cpu_exp_nonpos(float x) {
+  union { unsigned int u; float f; } c, k, scale;
+  c.f = x;
+  c.u = (c.u > 0xC2AE0000u) ? 0xC2AE0000u : c.u;  // x >= -87 (larger bits, more negative)
+  x = c.f;
+  k.f = x * 1.44269504f + 12582912.0f;  // n = round(x/ln2) in the low bits of k
+  float n = k.f - 12582912.0f;
+  float r = x - n * 0.693145751953125f - n * 1.428606765330187e-06f;
+  float p = 1.0f + r * (1.0f + r * (0.5f + r * (1.0f/6 + r * (1.0f/24 + r * (1.0f/120 + r * (1.0f/720))))));
+  scale.u = (k.u - 0x4B400000u + 127u) << 23;
+  return p * scale.f;
+}
+
+// Branch-free sigmoid and tanh (selects on the bits, as above)
+static inline float cpu_sigmoid_f(float x) {
+  union { unsigned int u; float f; } v, s, es;
+  v.f = x;
+  unsigned int neg = 0u - (v.u >> 31);
+  v.u &= 0x7FFFFFFFu;
+  float e = cpu_exp_nonpos(-v.f);
+  s.f = 1.0f / (1.0f + e);   // x >= 0
+  es.f = e * s.f;            // x < 0
+  s.u = (es.u & neg) | (s.u & ~neg);
+  return s.f;
+}
+
+static inline float cpu_tanh_f(float x) {
+  union { unsigned int u; float f; } v, t, p;
+  v.f = x;
+  unsigned int sign = v.u & 0x80000000u;
+  v.u &= 0x7FFFFFFFu;
+  float a = v.f;
+  float e = cpu_exp_nonpos(-2.0f * a);
+  t.f = (1.0f - e) / (1.0f + e);
+  // series for |x| < 0.125, where 1-e cancels
+  float a2 = a * a;
+  p.f = a * (1.0f - a2 * (1.0f/3 - a2 * (2.0f/15 - a2 * (17.0f/315))));
+  unsigned int small = (v.u < 0x3E000000u) ? 0xFFFFFFFFu : 0u;
+  t.u = ((p.u & small) | (t.u & ~small)) | sign;
+  return t.f;
+}
+
 // Aux
 float get_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsize);
 void add_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsize,float val);
@@ -24,6 +69,9 @@ void add_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsi
 void cpu_relu(Tensor *A, Tensor *B);
 void cpu_d_relu(Tensor *D, Tensor *I, Tensor *PD);
 
+// A+=bias (per channel, axis 1) followed by a FUSED_ACT_* activation, in place
+void cpu_bias_act(Tensor *A, Tensor *bias, int act);
+
 void cpu_thresholded_relu(Tensor *A, Tensor *B, float param);
 void cpu_d_thresholded_relu(Tensor *D, Tensor *I, Tensor *PD, float param);
 
@@ -60,6 +108,16 @@ void cpu_d_linear(Tensor *D, Tensor *I, Tensor *PD, float param);
 // Losses
 void cpu_cent(Tensor *A, Tensor *B, Tensor *C);
 void cpu_bin_cent(Tensor *A, Tensor *B, Tensor *C);
+float cpu_soft_cent(Tensor *T, Tensor *Y, Tensor *D);
+
+// Optimizers
+void cpu_adam(Tensor *P, Tensor *G, Tensor *M, Tensor *V, float lr, float beta_1, float beta_2, float epsilon,
+              float weight_decay, bool decoupled, int t);
+void cpu_zero_rows(Tensor *A, const vector<int> &rows);
+void cpu_sgd_rows(Tensor *P, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu);
+void cpu_adam_rows(Tensor *P, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1,
+                   float beta_2, float epsilon, float weight_decay, bool decoupled, int t);
+void cpu_rmsprop_rows(Tensor *P, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon);
 
 // Metrics
 int cpu_accuracy(Tensor *A, Tensor *B);
@@ -71,6 +129,15 @@ void cpu_conv2D(ConvolDescriptor *D);
 void cpu_conv2D_grad(ConvolDescriptor *D);
 void cpu_conv2D_back(ConvolDescriptor *D);
 
+// Transposed conv: D is the convolution from its output to its input
+void cpu_conv2DT(ConvolDescriptor *D, Tensor *bias);
+void cpu_conv2DT_grad(ConvolDescriptor *D, Tensor *gbias);
+void cpu_conv2DT_back(ConvolDescriptor *D, Tensor *PD);
+
+// Quantized (int8 weights) inference, see QuantDescriptor
+void cpu_qdense(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *C, int act);
+void cpu_qconv2D(ConvolDescriptor *D);
+
 // MaxPool
 void cpu_mpool2D(PoolDescriptor*D);
 void cpu_mpool2D_back(PoolDescriptor *D);
@@ -88,7 +155,15 @@ void cpu_select_back_nn(Tensor *A, Tensor *B, SelDescriptor *sd);
 void cpu_set_select_nn(Tensor *A, Tensor *B, SelDescriptor *sd);
 void cpu_set_select_back_nn(Tensor *A, Tensor *B, SelDescriptor *sd);
 
+// LSTM
+void cpu_lstm_pack(vector<Tensor *> W, Tensor *P);
+void cpu_lstm_cell(Tensor *G, Tensor *bias, Tensor *X, Tensor *prev_h, Tensor *prev_c, Tensor *H, Tensor *C, Tensor *SH);
+void cpu_d_lstm_cell(Tensor *G, Tensor *SH, Tensor *X, Tensor *prev_c, Tensor *DH, Tensor *DC, Tensor *prev_dh, Tensor *prev_dc);
+void cpu_lstm_grad(Tensor *A, Tensor *DG, vector<Tensor *> gW);
+
 // BN
+void cpu_batchnorm_forward(Tensor *input, Tensor *output, Tensor *opa, Tensor *mean, Tensor *variance, Tensor *bn_g, Tensor *bn_b, Tensor *bn_mean, Tensor *bn_var, float momentum, float epsilon, int trmode);
+void cpu_batchnorm_backward(Tensor *delta, Tensor *opa, Tensor *pdelta, Tensor *gbn_g, Tensor *gbn_b, Tensor *bn_g, Tensor *bn_var);
 void cpu_permute_channels_first(Tensor *A,Tensor *B);
 void cpu_permute_channels_last(Tensor *A,Tensor *B);
 void cpu_permute_batch_first(Tensor *A,Tensor *B);
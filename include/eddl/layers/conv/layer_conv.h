@@ -77,30 +77,38 @@ public:
 class LConvT : public LinLayer {
 public:
     static int total_layers;
-    ConvolDescriptor *cd;
+    ConvolDescriptor *cd; // convolution from the output to the input, K is {in, out, kr, kc}
+    vector<int> output_padding;
+    bool use_bias;
 
     // constructors and clones
     LConvT(Layer *parent, int filters, const vector<int> &kernel_size,
            const vector<int> &output_padding, string padding, const vector<int> &dilation_rate,
            const vector<int> &strides, bool use_bias, string name, int dev, int mem);
 
-    LConvT(Layer *parent, ConvolDescriptor *cd, string name, int dev, int mem);
+    // cd: kernels {in_channels, kr, kc}, strides and explicit pads of the output
+    LConvT(Layer *parent, ConvolDescriptor *cd, int filters, const vector<int> &output_padding, bool use_bias,
+           string name, int dev, int mem);
 
     // Destructor
     ~LConvT();
 
-//    Layer *share(int c, int bs, vector<Layer *> p) override;
-//
-//    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
-//
-//    // Params are in ConvolDescriptor
-//
-//    // implementation
-//    void forward() override;
-//
-//    void backward() override;
-//
-//    string plot(int c) override;
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+    // Params are in ConvolDescriptor
+
+    // implementation
+    void forward() override;
+
+    void backward() override;
+
+    void resize(int batch) override;
+
+    void update_weights(Tensor* w, Tensor* bias=nullptr) override;
+
+    string plot(int c) override;
 
 };
 
@@ -71,6 +71,8 @@ public:
 
     void free_delta() override;
 
+    void resize(int batch) override;
+
     void forward() override;
 
     void backward() override;
@@ -89,6 +91,8 @@ public:
     Tensor *E;
     Tensor *gE;
     vector<int> sind;
+    vector<int> touched;  // sorted rows of gE written since the last zeroGrads
+    bool gE_clean;  // gE is all zeros but the touched rows (CPU only)
     static int total_layers;
 
     LEmbedding(Layer *parent, int vocsize, int lenght, int dim, bool mask_zeros, string name, int dev, int mem);
@@ -103,6 +107,10 @@ public:
 
     void backward() override;
 
+    void zeroGrads() override;
+
+    vector<int> *sparse_rows(int i) override;
+
     string plot(int c) override;
 
 };
@@ -114,6 +122,8 @@ public:
     int ndim;
     bool use_bias;  // TODO: Implement
 	bool distributed_training;
+    int fused_act; // applied with the bias, see FUSED_ACT_*
+    QuantDescriptor *qd; // int8 weights, see Net::quantize
 
 	// Params
 	Tensor *W;
@@ -168,7 +178,7 @@ public:
 
     Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
 
-    void save(std::ofstream &ofs, string format) override;
+    void save(std::ofstream &ofs, string format, const string& dtype) override;
     void load(std::ifstream &ifs, string format) override;
 
     void forward() override;
@@ -330,4 +330,33 @@ public:
     string plot(int c) override;
 };
 
+/// Affine Layer (flip, rotation, scale and shift in a single pass)
+class LAffineRandom : public LDataAugmentation {
+public:
+    static int total_layers;
+    vector<float> rotation;
+    vector<float> scale;
+    vector<float> shift_x;
+    vector<float> shift_y;
+    int flip_axis;
+    vector<float> crop_scale;
+    vector<float> cutout_x;
+    vector<float> cutout_y;
+    bool bilinear;
+    WrappingMode da_mode;
+    float cval;
+
+    LAffineRandom(Layer *parent, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, bool bilinear, WrappingMode da_mode, float cval, string name, int dev, int mem);
+
+    Layer *share(int c, int bs, vector<Layer *> p) override;
+
+    Layer *clone(int c, int bs, vector<Layer *> p, int todev) override;
+
+    void forward() override;
+
+    void backward() override;
+
+    string plot(int c) override;
+};
+
 #endif //EDDL_LAYER_DA_H
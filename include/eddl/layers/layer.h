@@ -66,6 +66,7 @@ public:
     int lin, lout;
     int delta_bp;
     bool detached;
+    unsigned long params_version; // see params_changed
     unsigned int verbosity_level = 0;
 
     Layer(string name, int dev, int mem);
@@ -88,6 +89,7 @@ public:
     Tensor* setBias(Tensor bias);
 
     void clamp(float min,float max);
+    void params_changed();
     void set_detach();
 
     void set_mem_level(int mem);
@@ -103,12 +105,14 @@ public:
     virtual void resize(int batch);
     virtual void set_trainable(bool value);
 
-    virtual void save(std::ofstream &ofs, string format="");
+    virtual void save(std::ofstream &ofs, string format="", const string& dtype="float32");
     virtual void load(std::ifstream &ifs, string format="");
 
     virtual void reset();
     virtual int get_trainable_params_count();
     virtual void zeroGrads();
+    // Rows of gradients[i] written since the last zeroGrads, nullptr when dense
+    virtual vector<int> *sparse_rows(int i) { return nullptr; }
     virtual string plot(int c) { return ""; }
 
     virtual void addchild(Layer *l) {}
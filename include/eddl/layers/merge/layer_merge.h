@@ -148,6 +148,10 @@ public:
     unsigned int axis;
     vector<int> index;
     static int total_layers;
+    bool inplace=false;  // see Net::inplace_concat
+    vector<bool> strided;  // the parent can write its output with the batch stride of the output
+    vector<bool> sliced;  // the parent writes its output into its slice of the output
+    bool aliased=false;  // all the parents are sliced
 
     // constructors and clones
     LConcat(vector<Layer *> in, unsigned int axis, string name, int dev, int mem);
@@ -159,6 +163,10 @@ public:
     // Params
 
     // implementation
+    void alias_parents();
+
+    void mem_delta_parent() override;
+
     void forward() override;
 
     void backward() override;
@@ -118,6 +118,12 @@ public:
     Tensor *psh;
     Tensor *psc;
 
+    // CPU: gates packed as [i | f | o | c]
+    Tensor *gates;
+    LLSTM *base; // owner of the packed weights (shared by the unrolled layers)
+    Tensor *Wx_packed, *Wh_packed, *bias_packed;
+    unsigned long packed_version; // weights_version of the packed weights
+
 
     LLSTM(vector<Layer *> in, int units,  bool mask_zeros, bool bidirectional, string name, int dev, int mem);
 
@@ -135,6 +141,9 @@ public:
 
     void backward() override;
 
+    unsigned long weights_version();
+    void pack_weights();
+
     string plot(int c) override;
 };
 
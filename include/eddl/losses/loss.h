@@ -27,6 +27,7 @@ public:
 
     virtual void delta(Tensor *T, Tensor *Y, Tensor *D);
     virtual float value(Tensor *T, Tensor *Y);
+    virtual float value_delta(Tensor *T, Tensor *Y, Tensor *D);  // value() and delta() at once
     virtual Loss* clone();
 };
 
@@ -106,6 +107,7 @@ public:
 
     void delta(Tensor *T, Tensor *Y, Tensor *D) override;
     float value(Tensor *T, Tensor *Y) override;
+    float value_delta(Tensor *T, Tensor *Y, Tensor *D) override;
     Loss* clone() override;
 };
 
@@ -0,0 +1,41 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_DATASET_H
+#define EDDL_DATASET_H
+
+#include <vector>
+#include <string>
+
+#include "eddl/tensor/tensor.h"
+
+using namespace std;
+
+// One or more tensors (shards) seen as a single one, concatenated along the
+// first dim (samples). Shards loaded from bin files are memory mapped
+class Dataset {
+public:
+    vector<Tensor *> shards;
+    vector<int> offsets;  // first sample of each shard
+    vector<int> shape;    // logical shape
+    int num_samples;
+    bool owner;
+
+    Dataset(const vector<string> &filenames, bool sequential=true);
+    explicit Dataset(Tensor *t);  // Not owned
+    ~Dataset();
+
+    // B = samples "sind" (B->shape[0] == sind.size())
+    void select(const vector<int> &sind, Tensor *B);
+
+private:
+    void set_shape();
+};
+
+#endif //EDDL_DATASET_H
@@ -38,6 +38,9 @@ int isInorig(Layer *l, vlayer vl, int &ind);
 
 #define MAX_THREADS 1024
 
+struct SnetPool;
+class ConvolWorkspace;
+
 class Net {
 private:
     void build(Optimizer *opt, vloss lo, vmetrics me, bool initialize=true);
@@ -58,6 +61,7 @@ public:
     bool isbuild;
     bool isdecoder;
     bool isencoder;
+    bool isinference; // see optimize_inference and quantize, no backward
     int decsize;
 
     vector<int> devsel;
@@ -80,9 +84,14 @@ public:
     FILE *flog_ts;
 
     Optimizer *optimizer;
+    ConvolWorkspace *conv_ws=nullptr; // im2col buffer of the CPU convolutions
+    float *arena=nullptr; // outputs of the hidden layers, see plan_memory
+    unsigned long arena_size=0;
+    bool isplanned=false;
     vector<Net *> snets;
     vector<Net *> mnets;
     Net* rnet;
+    SnetPool *pool;
 
     vtensor Xs[MAX_THREADS];
     vtensor Ys[MAX_THREADS];
@@ -106,6 +115,12 @@ public:
     Net *unroll_dec(int inl, int outl);
     void build_rnet(int inl,int outl);
     Layer* getLayer(vlayer in);
+    void optimize_inference();
+    void inplace_concat();
+    void alias_concats();
+    void plan_memory();
+    void assign_memory();
+    void quantize(vector<Tensor *> calibration, const string& dtype="int8", bool keep_float=false);
 
     int inNet(Layer *l);
     void walk(Layer *l);
@@ -122,7 +137,7 @@ public:
     void setmode(int m);
 
 
-    void save(const string& filename, string format="");
+    void save(const string& filename, string format="", const string& dtype="float32");
     void load(const string& filename, string format="");
     void setlogfile(string fname);
 
@@ -134,6 +149,7 @@ public:
     void do_forward();
     void do_delta();
     void do_compute_loss();
+    void do_compute_loss_delta();
     void do_backward();
     void do_applygrads();
 
@@ -144,6 +160,7 @@ public:
 
     // API
     void run_snets(void *(*F)(void *t));
+    void stop_snets();
     void forward(vector<Layer *> in);
     void forward(vector<Tensor*> in);
     void forward();
@@ -169,6 +186,7 @@ public:
 
     void fit_recurrent(vtensor tin, vtensor tout, int batch_size, int epochs);
     void train_batch(vtensor X, vtensor Y, vind sind, int eval = 0);
+    void train_batch_ordered(vtensor X, vtensor Y);
     void evaluate(vtensor tin, vtensor tout);
     void evaluate_recurrent(vtensor tin, vtensor tout);
     vtensor predict_recurrent(vtensor tin);
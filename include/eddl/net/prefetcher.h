@@ -0,0 +1,79 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#ifndef EDDL_PREFETCHER_H
+#define EDDL_PREFETCHER_H
+
+#include <vector>
+#include <random>
+#include <exception>
+#include <functional>
+#include <pthread.h>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/net/dataset.h"
+
+using namespace std;
+
+// Batches are gathered by a background thread into a ring of "depth" slots
+// while the caller works on the previous one. Samples are visited once per
+// epoch (in a new random order if shuffle), the last partial batch is dropped.
+class Prefetcher {
+public:
+    vector<Dataset *> X;
+    vector<Dataset *> Y;
+    int batch_size;
+    int depth;
+    bool shuffle;
+    int num_samples;
+    int num_batches;  // per epoch
+
+    // Optional, run by the worker on each batch (normalization, augmentation...)
+    std::function<void(vector<Tensor *> &, vector<Tensor *> &)> transform;
+
+    // Time and number of times next() had to wait for the worker
+    double stall_time;
+    int stalls;
+
+    Prefetcher(vector<Tensor *> X, vector<Tensor *> Y, int batch_size, bool shuffle=true, int depth=2);
+    Prefetcher(vector<Dataset *> X, vector<Dataset *> Y, int batch_size, bool shuffle=true, int depth=2);
+    ~Prefetcher();
+
+    // Batch views valid until the next call. Returns false (no batch) once at
+    // the end of every epoch; the following call starts the next epoch
+    bool next(vector<Tensor *> &bx, vector<Tensor *> &by);
+
+    void stop();
+
+private:
+    vector<Dataset *> wrapped;  // Datasets created for plain tensors
+    vector<vector<Tensor *>> sx;
+    vector<vector<Tensor *>> sy;
+    vector<int> perm;
+    std::mt19937 rng;
+
+    pthread_t thr;
+    pthread_mutex_t mtx;
+    pthread_cond_t ready_cv;
+    pthread_cond_t free_cv;
+    bool running;
+    bool halt;
+    std::exception_ptr error;
+
+    long produced;  // batches filled by the worker
+    long consumed;  // batches handed to the caller
+    long released;  // slots given back to the worker
+    int pos;        // batch within the current epoch (caller side)
+
+    void init();
+    static void *worker_t(void *t);
+    void fill(long k);
+};
+
+#endif //EDDL_PREFETCHER_H
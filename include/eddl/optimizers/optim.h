@@ -79,11 +79,12 @@ public:
     float epsilon;
     float weight_decay;
     bool amsgrad;
+    bool decoupled;  // AdamW: weight decay applied to the params instead of the gradients
     int t;
 
     vtensor mT;
     vtensor vT;
-    vtensor mCap;
+    vtensor mCap;  // Only for non-CPU params (CPU uses the fused kernel)
     vtensor vCap;
 
     explicit Adam(float lr=0.01f, float beta_1=0.9f, float beta_2=0.999f, float epsilon=1e-8f, float weight_decay=0.0f, bool amsgrad=false);
@@ -99,6 +100,17 @@ public:
     void change(vector<float> &p) override;
 };
 
+// ---- AdamW ----
+class AdamW: public Adam {
+public:
+    explicit AdamW(float lr=0.001f, float beta_1=0.9f, float beta_2=0.999f, float epsilon=1e-8f, float weight_decay=0.01f, bool amsgrad=false);
+
+    Optimizer *clone() override;
+    Optimizer *share() override;
+
+    void change(vector<float> &p) override;
+};
+
 
 // ---- AdaDelta ----
 class AdaDelta : public Optimizer {
@@ -10,6 +10,32 @@
 #ifndef EDDL_RANDOM_H
 #define EDDL_RANDOM_H
 
+#include <cstdint>
+
+// Counter-based generator (Philox4x32-10, Salmon et al. 2011). Each value only
+// depends on the seed and its counter, so results do not change with the number of threads
+void set_random_seed(uint64_t seed);
+uint64_t get_random_seed();
+uint64_t reserve_random_counters(uint64_t n);  // First of n consecutive (unused) counters
+
+inline void philox4x32(uint64_t counter, uint64_t key, uint32_t out[4]) {
+    uint32_t c0 = (uint32_t)counter, c1 = (uint32_t)(counter >> 32), c2 = 0, c3 = 0;
+    uint32_t k0 = (uint32_t)key, k1 = (uint32_t)(key >> 32);
+    for (int r = 0; r < 10; r++) {
+        uint64_t p0 = (uint64_t)0xD2511F53 * c0;
+        uint64_t p1 = (uint64_t)0xCD9E8D57 * c2;
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+        k0 += 0x9E3779B9; k1 += 0xBB67AE85;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// [0, 1) with 24 random bits
+inline float philox_uniform(uint32_t x) { return (float)(x >> 8) * (1.0f / 16777216.0f); }
+
 float gaussgen();
 void build_randn_table();
 
@@ -35,8 +35,9 @@
 	// Exporting module
 	//----------------------------------------------------------------------------------------
 
-	// Saves a model with the onnx format in the file path provided
-	void save_net_to_onnx_file( Net *net, string path );
+	// Saves a model with the onnx format in the file path provided. Weights
+	// can be stored as "float16" (cast back to float in the graph)
+	void save_net_to_onnx_file( Net *net, string path, const string& dtype="float32" );
 
 	// Returns a pointer to the serialized model in Onnx
 	size_t serialize_net_to_onnx_pointer( Net *net, void * & serialized_model, bool gradients=false );
@@ -17,6 +17,18 @@ namespace tensorNN{
 
 // ***** Losses *****************************
     void cent(Tensor *A, Tensor *B, Tensor *C);
+    float soft_cent(Tensor *T, Tensor *Y, Tensor *D);
+
+// ***** Optimizers *****************************
+    void adam(Tensor *P, Tensor *G, Tensor *M, Tensor *V, float lr, float beta_1, float beta_2, float epsilon,
+              float weight_decay, bool decoupled, int t);
+
+// Row-sparse versions: only the given rows of {rows,d} tensors are updated
+    void zero_rows(Tensor *A, const vector<int> &rows);
+    void sgd_rows(Tensor *P, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu);
+    void adam_rows(Tensor *P, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1,
+                   float beta_2, float epsilon, float weight_decay, bool decoupled, int t);
+    void rmsprop_rows(Tensor *P, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon);
 
 // ***** Metrics *****************************
 int accuracy(Tensor *A, Tensor *B);
@@ -28,6 +40,9 @@ int bin_accuracy(Tensor *A, Tensor *B);
     void ReLu(Tensor *A, Tensor *B);
     void D_ReLu(Tensor *D, Tensor *I, Tensor *PD);
 
+// Bias (per channel) + FUSED_ACT_* activation, in place
+    void BiasActivation(Tensor *A, Tensor *bias, int act);
+
     void LeakyReLu(Tensor *A, Tensor *B,float param);
     void D_LeakyReLu(Tensor *D, Tensor *I, Tensor *PD,float param);
 
@@ -77,6 +92,14 @@ int bin_accuracy(Tensor *A, Tensor *B);
     void Conv2D_grad(ConvolDescriptor *D);
     void Conv2D_back(ConvolDescriptor *D);
 
+// Conv2DT (transposed), see LConvT
+    void Conv2DT(ConvolDescriptor *D, Tensor *bias);
+    void Conv2DT_grad(ConvolDescriptor *D, Tensor *gbias);
+    void Conv2DT_back(ConvolDescriptor *D, Tensor *PD);
+
+// Quantized Dense (Conv2D uses D->qd when set)
+    void QDense(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *C, int act);
+
 // MaxPool
     void MPool2D(PoolDescriptor *D);
     void MPool2D_back(PoolDescriptor *D);
@@ -86,6 +109,12 @@ int bin_accuracy(Tensor *A, Tensor *B);
     void AvgPool2D(PoolDescriptor *D);
     void AvgPool2D_back(PoolDescriptor *D);
 
+// LSTM
+    void lstm_pack(vector<Tensor *> W, Tensor *P);
+    void lstm_cell(Tensor *G, Tensor *bias, Tensor *X, Tensor *prev_h, Tensor *prev_c, Tensor *H, Tensor *C, Tensor *SH);
+    void d_lstm_cell(Tensor *G, Tensor *SH, Tensor *X, Tensor *prev_c, Tensor *DH, Tensor *DC, Tensor *prev_dh, Tensor *prev_dc);
+    void lstm_grad(Tensor *A, Tensor *DG, vector<Tensor *> gW);
+
 // ***** Tensor operations *****************************
     void repeat_nn(Tensor *A, Tensor *B, vector<int> size);
     void d_repeat_nn(Tensor *D, Tensor *P, vector<int> size);
@@ -95,6 +124,10 @@ int bin_accuracy(Tensor *A, Tensor *B);
     void set_select(Tensor *A, Tensor *B, SelDescriptor *sd);
     void set_select_back(Tensor *A, Tensor* B, SelDescriptor *sd);
 
+// ***** BatchNorm (statistics per channel, NCHW) *******
+    void BatchNormForward(Tensor *input, Tensor *output, Tensor *opa, Tensor *mean, Tensor *variance, Tensor *bn_g, Tensor *bn_b, Tensor *bn_mean, Tensor *bn_var, float momentum, float epsilon, int trmode);
+    void BatchNormBackward(Tensor *delta, Tensor *opa, Tensor *pdelta, Tensor *gbn_g, Tensor *gbn_b, Tensor *bn_g, Tensor *bn_var);
+
 // ***** Permutations for BatchNorm ********************
     void permute_channels_last(Tensor *A,Tensor *B);
     void permute_channels_first(Tensor *A,Tensor *B);
@@ -72,7 +72,7 @@ private:
 //    static Tensor* load_from_txt(std::ifstream &ifs, char delimiter, int headerRows);  // Deprecated
 
     // Save methods
-    void save2bin(std::ofstream &ofs);
+    void save2bin(std::ofstream &ofs, int dtype=DTYPE_FLOAT32, bool aligned=false);
     void save2onnx(std::ofstream &ofs);
     void save2img(const string &filename, string format);
 //    void save2numpy(const string &filename, string format);
@@ -88,6 +88,8 @@ public:
     // Data pointers
     float *ptr = nullptr;
     Eigen::Map<Eigen::MatrixXf> *ptr2 = nullptr;  // TODO: I don't like it. float or eigen, not both
+    bool isshared = false;  // ptr belongs to another tensor (e.g. a slice of a concat, see LConcat): not freed
+    unsigned long version = 0;  // bumped when Tensor::copy writes the data, so what is derived from it can be checked (see LLSTM)
 
     // Aux variables
     int gpu_device;
@@ -254,6 +256,16 @@ public:
     static Tensor* load(const string& filename, string format="");
     template<typename T> static Tensor* load(const string& filename, string format="");
 
+    /**
+      *  @brief Map a bin file in memory instead of reading it. Pages are read on first access, so it also works for files larger than the RAM.
+      *  @details Files written by Tensor::save with aligned=true have a 64-byte header, so their data is mapped 64-byte aligned.
+      *
+      *  @param filename  Name of the bin file.
+      *  @param sequential  Access hint: sequential (read-ahead) or random.
+      *  @return    Tensor backed by the file. Writes are private (the file is never modified)
+    */
+    static Tensor* load_mapped(const string& filename, bool sequential=true);
+
     /**
       *  @brief Load data from a text file
       *
@@ -271,9 +283,10 @@ public:
       *  @param format    Format to use. The accepted formats are the following:
       *                     - Text: csv, tsv, txt
       *                     - Other: bin, onnx
+      *  @param dtype    Storage type of the values in "bin" files: float32, bfloat16 or float16
       *  @return    void
     */
-    void savefs(std::ofstream &ofs, string format="");
+    void savefs(std::ofstream &ofs, string format="", const string& dtype="float32");
 
     /**
       *  @brief Save tensor to a file.
@@ -284,9 +297,11 @@ public:
       *                     - Numpy: npy, npz
       *                     - Text: csv, tsv, txt
       *                     - Other: bin, onnx
+      *  @param dtype    Storage type of the values in "bin" files: float32, bfloat16 or float16
+      *  @param aligned    "bin" files: pad the header to 64 bytes, so the data is aligned when mapped (see load_mapped). Versions without it can not read these files
       *  @return    void
     */
-    void save(const string& filename, string format="");
+    void save(const string& filename, string format="", const string& dtype="float32", bool aligned=false);
 
     /**
       *  @brief Save tensor to a text file.
@@ -1995,6 +2010,27 @@ public:
     */
     static void cutout_random(Tensor *A, Tensor *B, vector<float> factor_x, vector<float> factor_y, float cval=0.0f);
 
+    /**
+    *   @brief Random crop-scale, flip, rotation, scale, shift and cutout applied in a single pass. The transforms of each sample are merged into one affine map, so the image is resampled only once, and the cutout is filled while it is written.
+    *   @param A Input tensor.
+    *   @param B Output tensor.
+    *   @param rotation The rotation angle range in degrees.
+    *   @param scale Vector with minimum and maximum scale factors.
+    *   @param shift_x vector with the lower and upper values for shift in axis x.
+    *   @param shift_y vector with the lower and upper values for shift in axis y.
+    *   @param flip_axis Axis flipped with probability 0.5 (-1 for none).
+    *   @param crop_scale Range of the size of a random crop (fraction of the image), scaled back to the full size. {1, 1} for none.
+    *   @param cutout_x Range of the width of a random area filled with ``cval`` (fraction of the width).
+    *   @param cutout_y Range of the height of that area (fraction of the height). {0, 0} for none.
+    *   @param bilinear Bilinear interpolation (nearest neighbour otherwise).
+    *   @param mode Must be one of the following:
+    *        - ``WrappingMode::Constant``: Input extended by the value in ``cval`` (v v v v | a b c d | v v v v)
+    *        - ``WrappingMode::Nearest``: Input extended by replicating the last pixel (a a a a | a b c d | d d d d)
+    *        - ``WrappingMode::Original``: Input extended by placing the original image in the background.
+    *   @param cval Value to fill past edges of input if mode is ``WrappingMode::Constant``
+    */
+    static void affine_random(Tensor *A, Tensor *B, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis=-1, vector<float> crop_scale={1.0f, 1.0f}, vector<float> cutout_x={0.0f, 0.0f}, vector<float> cutout_y={0.0f, 0.0f}, bool bilinear=true, WrappingMode mode=WrappingMode::Constant, float cval=0.0f);
+
 
     // Linear algebra *****************************
 
@@ -2603,7 +2639,7 @@ public:
       *
       *  @param m  Mean of the normal distribution.
       *  @param s  Standard deviation of the normal distribution.
-      *  @param fast_math  Wether to use or not the fast math mode.
+      *  @param fast_math  Single precision (CPU). Otherwise double precision, with longer tails.
     */
     void rand_normal(float m, float s, bool fast_math=true);
 
@@ -18,7 +18,11 @@ using namespace std;
 
 void msg(const string& text, const string& title="");
 
+// Requests bigger than this are checked against the free memory of the system
+#define FMEM_CHECK_THRESHOLD (64UL << 20)
+
 float *get_fmem(unsigned long int size, const string &str);
+void free_fmem(float *ptr);
 
 string bytes2human(unsigned long long int bytes, int decimals=2);
 
@@ -26,6 +30,15 @@ unsigned long get_free_mem();
 
 string get_extension(string filename);
 
+// Storage types of the values. Tensors are float32 in memory, the others are
+// used to serialize them and for reduced precision weights (see Net::quantize)
+#define DTYPE_FLOAT32 0
+#define DTYPE_BFLOAT16 1
+#define DTYPE_FLOAT16 2
+#define DTYPE_INT8 3
+
+int get_dtype(const string &name);
+
 vector<vector<int>> parse_indices(vector<string> str_indices, const vector<int>& shape);
 
 vector<int> indices2shape(vector<vector<int>> ranges);
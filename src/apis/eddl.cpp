@@ -15,6 +15,8 @@
 #include <stdexcept>
 
 #include "eddl/apis/eddl.h"
+#include "eddl/hardware/cpu/cpu_profile.h"
+#include "eddl/random.h"
 
 
 using namespace std;
@@ -91,6 +93,22 @@ namespace eddl {
         net->build(o, l, m, cs, init_weights);
     }
 
+    void optimize_inference(model net){
+        net->optimize_inference();
+    }
+
+    void quantize(model net, vector<Tensor *> calibration, const string& dtype, bool keep_float){
+        net->quantize(calibration, dtype, keep_float);
+    }
+
+    void inplace_concat(model net){
+        net->inplace_concat();
+    }
+
+    void plan_memory(model net){
+        net->plan_memory();
+    }
+
     // Computing services
 
     // GPU
@@ -209,8 +227,8 @@ namespace eddl {
         m->load(fname,format);
     }
 
-    void save(model m, const string&  fname, string format){
-        m->save(fname,format);
+    void save(model m, const string&  fname, string format, const string& dtype){
+        m->save(fname,format,dtype);
     }
 
     // Optimizer
@@ -228,6 +246,10 @@ namespace eddl {
         return new Adam(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad);
     }
 
+    optimizer adamw(float lr, float beta_1, float beta_2, float epsilon, float weight_decay, bool amsgrad){
+        return new AdamW(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad);
+    }
+
     optimizer adagrad(float lr, float epsilon, float weight_decay){
         //Todo: Implement
         return new Adagrad(lr, epsilon, weight_decay);
@@ -293,6 +315,22 @@ namespace eddl {
             Tensor::select(in[i], out[i], sind, 0, batch_size);
     }
 
+    dataloader prefetch(const vector<Tensor *> &in, const vector<Tensor *> &out, int batch_size, bool shuffle, int depth){
+        return new Prefetcher(in, out, batch_size, shuffle, depth);
+    }
+
+    dataloader prefetch(const vector<Dataset *> &in, const vector<Dataset *> &out, int batch_size, bool shuffle, int depth){
+        return new Prefetcher(in, out, batch_size, shuffle, depth);
+    }
+
+    bool next_batch(dataloader l, vector<Tensor *> &in, vector<Tensor *> &out){
+        return l->next(in, out);
+    }
+
+    Dataset *open_dataset(const vector<string> &filenames, bool sequential){
+        return new Dataset(filenames, sequential);
+    }
+
     void train_batch(model net, vector<Tensor *> in, vector<Tensor *> out){
         net->tr_batches++;
         vector<int> indices;
@@ -388,6 +426,32 @@ namespace eddl {
         m->clamp(min,max);
     }
 
+    // profiling
+    void enable_profiling(bool trace){
+        _profile_enable(trace);
+    }
+
+    void disable_profiling(){
+        _profile_disable();
+    }
+
+    void reset_profiling(){
+        _profile_reset();
+    }
+
+    void show_profile(){
+        _show_profile();
+    }
+
+    void save_profile_trace(const string& fname){
+        _profile_export_trace(fname);
+    }
+
+    // random
+    void set_seed(unsigned long seed){
+        set_random_seed(seed);
+    }
+
 
     // loss and metrics methods
     float compute_loss(loss L)
@@ -558,6 +622,13 @@ namespace eddl {
         return new LConv(parent, filters, kernel_size, strides, padding, groups, dilation_rate, use_bias, name, DEV_CPU, 0);
     }
 
+    layer DepthwiseConv2D(layer parent, const vector<int> &kernel_size,
+                          const vector<int> &strides, string padding, bool use_bias,
+                          int depth_multiplier, const vector<int> &dilation_rate, string name){
+        int channels=parent->output->shape[1];
+        return new LConv(parent, channels*depth_multiplier, kernel_size, strides, padding, channels, dilation_rate, use_bias, name, DEV_CPU, 0);
+    }
+
     layer Conv1D(layer parent, int filters, vector<int> kernel_size,
                vector<int> strides, string padding,  bool use_bias,
                int groups, vector<int> dilation_rate,string name){
@@ -568,6 +639,7 @@ namespace eddl {
 
         kernel_size.push_back(1);
         strides.push_back(1);
+        dilation_rate.push_back(1);
         LConv *lc=new LConv(l, filters, kernel_size, strides, padding, groups, dilation_rate, use_bias, name, DEV_CPU, 0);
 
         vector<int> shape2=lc->output->getShape();
@@ -719,6 +791,12 @@ namespace eddl {
         return new LCutoutRandom(parent, factor_x, factor_y, constant, name, DEV_CPU, 0);
     }
 
+    layer RandomAffine(layer parent, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, string interpolation, string da_mode, float constant, string name){
+        if (interpolation!="bilinear" && interpolation!="nearest")
+            msg("Unknown interpolation (" + interpolation + ")", "RandomAffine");
+        return new LAffineRandom(parent, rotation, scale, shift_x, shift_y, flip_axis, crop_scale, cutout_x, cutout_y, interpolation=="bilinear", getWrappingMode(da_mode), constant, name, DEV_CPU, 0);
+    }
+
     // Merge Layers
     layer Add(const vector<layer> &layers, string name){
         return new LAdd(layers, name, DEV_CPU, 0);
@@ -12,6 +12,10 @@
 #include <cmath>
 #include <algorithm>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "eddl/hardware/cpu/cpu_profile.h"
 
 #ifdef cGPU
@@ -23,23 +27,48 @@
 #include "eddl/hardware/fpga/fpga_hw.h"
 #endif
 
+ConvolWorkspace::~ConvolWorkspace() {
+    free_fmem(ptr);
+}
+
+// The content is lost when it grows
+float *ConvolWorkspace::reserve(size_t n) {
+    if (n > size) {
+        free_fmem(ptr);
+        ptr = get_fmem(n, "ConvolWorkspace::reserve");
+        _profile_add_tensor(n - size);
+        size = n;
+        owner = nullptr;
+    }
+    return ptr;
+}
+
+
 ConvolDescriptor::ConvolDescriptor() {}
 
-ConvolDescriptor::ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem) {
+ConvolDescriptor::ConvolDescriptor(const vector<int> &ks, const vector<int> &st, const vector<int> &p, int mem,
+                                   int g, const vector<int> &dilation_rate) {
     ksize = vector<int>(ks.begin(), ks.end());
     stride = vector<int>(st.begin(), st.end());
     pad = vector<int>(p.begin(), p.end());
     mem_level=mem;
 
+    if (dilation_rate.size() != 2) msg("Dilation rates must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor");
+    groups=g;
+    dr=dilation_rate[0];
+    dc=dilation_rate[1];
+
     this->padding = "custom";
 
     if (ksize.size() != 3) msg("Kernels must have 3 dimensions", "ConvolDescriptor::ConvolDescriptor");
     if (stride.size() != 2) msg("Strides must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor");
 }
 
-ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool ub, int mem) {
+ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vector<int> &st, const string& p, bool ub, int mem,
+                                   int g, const vector<int> &dilation_rate) {
     if (ks.size() != 2) { msg("Kernels must have 3 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
     if (st.size() != 2) { msg("Strides must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
+    if (dilation_rate.size() != 2) { msg("Dilation rates must have 2 dimensions", "ConvolDescriptor::ConvolDescriptor"); }
 
     // Add filters to kernel_size
     ksize = vector<int>(ks);
@@ -47,6 +76,9 @@ ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vec
     stride = vector<int>(st.begin(), st.end());
     use_bias=ub;
     mem_level=mem;
+    groups=g;
+    dr=dilation_rate[0];
+    dc=dilation_rate[1];
 
     if (p=="same" || p =="none" || p =="valid" || p =="zeros" || p=="same,none" || p=="none,same") {
         this->padding=p;
@@ -59,6 +91,9 @@ ConvolDescriptor::ConvolDescriptor(int filters, const vector<int> &ks, const vec
 
 ConvolDescriptor::~ConvolDescriptor(){
     // input, output, delta, params[], and gradients[], acc_gradients[] => deleted in ~Layer()
+    free_fmem(ptrI);
+    delete qd;
+    if (own_ws) delete ws;
 }
 
 void ConvolDescriptor::build(Tensor *A) {
@@ -67,10 +102,20 @@ void ConvolDescriptor::build(Tensor *A) {
 
     I = A;
 
+    if ((groups < 1) || (dr < 1) || (dc < 1)) msg("Groups and dilation rates must be positive", "ConvolDescriptor::build");
+    if ((A->shape[1] % groups) || (ksize[0] % groups))
+        msg("Input channels and filters must be divisible by the groups", "ConvolDescriptor::build");
+    if (!A->isCPU() && ((groups > 1) || (dr > 1) || (dc > 1)))
+        msg("Grouped and dilated convolutions are only implemented for CPU", "ConvolDescriptor::build");
+
     nk = ksize[0];
     kr = ksize[1];
     kc = ksize[2];
-    kz = A->shape[1];
+    kz = A->shape[1] / groups;
+
+    // extent of the dilated kernels
+    int ekr = (kr - 1) * dr + 1;
+    int ekc = (kc - 1) * dc + 1;
 
     sr = stride[0];
     sc = stride[1];
@@ -83,26 +128,26 @@ void ConvolDescriptor::build(Tensor *A) {
         // Compute output
         z = nk;
         vector<int>pr; pr.push_back(pad[0]);pr.push_back(pad[1]);
-        r = compute_output(pr, ir, kr, sr);
+        r = compute_output(pr, ir, kr, sr, dr);
 
         vector<int>pc; pc.push_back(pad[2]);pc.push_back(pad[3]);
-        c = compute_output(pc, ic, kc, sc);
+        c = compute_output(pc, ic, kc, sc, dc);
 
     }else{  // Common padding (same/zeros)
         // Compute output
         z = nk;
 
-        if (padding=="same,none") r = compute_output("same", ir, kr, sr);
-        else if (padding=="none,same")  r = compute_output("none", ir, kr, sr);
-        else r = compute_output(this->padding, ir, kr, sr);
+        if (padding=="same,none") r = compute_output("same", ir, kr, sr, dr);
+        else if (padding=="none,same")  r = compute_output("none", ir, kr, sr, dr);
+        else r = compute_output(this->padding, ir, kr, sr, dr);
 
-        if (padding=="same,none") c = compute_output("none", ic, kc, sc);
-        else if (padding=="none,same")  c = compute_output("same", ic, kc, sc);
-        else c = compute_output(this->padding, ic, kc, sc);
+        if (padding=="same,none") c = compute_output("none", ic, kc, sc, dc);
+        else if (padding=="none,same")  c = compute_output("same", ic, kc, sc, dc);
+        else c = compute_output(this->padding, ic, kc, sc, dc);
 
         // Compute padding
-        vector<int> padr = compute_padding(r, ir, kr, sr, this->padding,true);  // Order: [top, bottom]
-        vector<int> padc = compute_padding(c, ic, kc, sc, this->padding,false);  // Order: [left, right]
+        vector<int> padr = compute_padding(r, ir, ekr, sr, this->padding,true);  // Order: [top, bottom]
+        vector<int> padc = compute_padding(c, ic, ekc, sc, this->padding,false);  // Order: [left, right]
 
         // Set padding
         pad = {padr[0], padr[1], padc[0], padc[1]};  // top, bottom, left, right
@@ -127,9 +172,8 @@ void ConvolDescriptor::build(Tensor *A) {
     gbias = new Tensor(vector<int>{nk}, I->device);
 
     if (I->isCPU()) {
-        // mem for ptr, lowering im2col
-        ptrI=get_fmem(A->shape[0] * r * c * kr * kc * kz,"ConvolDescriptor::build");
-	 _profile_add_tensor(A->shape[0] * r * c * kr * kc * kz);
+        // Pick the algorithm once for this shape
+        set_cpu_algo(select_cpu_algo());
         new(&matK) Eigen::Map<Eigen::MatrixXf>(K->ptr, kr * kc * kz, nk);
         new(&matgK) Eigen::Map<Eigen::MatrixXf>(gK->ptr, kr * kc * kz, nk);
         // convolution: matC=matA*matK
@@ -188,13 +232,9 @@ void ConvolDescriptor::resize(int b)
     O->resize(b);
 //    if (!mem_level) D->resize(b);
 
-    if (I->isCPU()) {
-        delete[] ptrI;
-        ptrI=get_fmem(b * r * c * kr * kc * kz, "ConvolDescriptor::build");
-	 _profile_add_tensor(b * r * c * kr * kc * kz);
-    }
+    // CPU: the workspace grows when needed
 #ifdef cGPU
-    else if (I->isGPU()) {
+    if (I->isGPU()) {
         if (mem_level<2)
             gpuIB->resize(b*r*c);
         if (mem_level==0) {
@@ -205,13 +245,13 @@ void ConvolDescriptor::resize(int b)
 #endif
 
 #ifdef cFPGA
-    else if (I->isFPGA()) {
+    if (I->isFPGA()) {
         // We reallocate memory on the FGPA for the im2col buffer
 	fpga_destroy_memory(fpga_ptrI);
 	fpga_sizeI = b * r * c * kr * kc * kz * sizeof(float);
         fpga_ptrI = fpga_create_memory(fpga_sizeI);
         // We do the same on the CPU side (for smooth cpuemu)
-	delete ptrI;
+	free_fmem(ptrI);
         ptrI=get_fmem(b * r * c * kr * kc * kz, "ConvolDescriptor::build");
     }
 #endif
@@ -227,6 +267,80 @@ void ConvolDescriptor::enable_distributed() {
     acc_gbias->fill_(0.0);
 }
 
+int ConvolDescriptor::select_cpu_algo() {
+    // Depthwise (and channel multipliers): too little work per pixel for a GEMM
+    if (kz==1 && groups>1)
+        return CONV_ALGO_DEPTHWISE;
+
+    // The rest of grouped and dilated convolutions are lowered group by group
+    if (groups>1 || dr>1 || dc>1)
+        return CONV_ALGO_IM2COL;
+
+    // 1x1 convolutions without stride or padding are a plain GEMM on the input
+    if (kr==1 && kc==1 && sr==1 && sc==1 && padrt==0 && padrb==0 && padcl==0 && padcr==0)
+        return CONV_ALGO_DIRECT_1X1;
+
+    // Winograd only pays off when the transforms are amortized over enough channels
+    if (kr==3 && kc==3 && sr==1 && sc==1 && kz>=8 && nk>=8) {
+        if (r>=8 && c>=8) return CONV_ALGO_WINOGRAD_4X4;
+        return CONV_ALGO_WINOGRAD_2X2;
+    }
+
+    return CONV_ALGO_IM2COL;
+}
+
+void ConvolDescriptor::set_cpu_algo(int algo) {
+    if (!I->isCPU()) msg("Only CPU convolutions can select an algorithm", "ConvolDescriptor::set_cpu_algo");
+
+    if (algo==CONV_ALGO_DIRECT_1X1) {
+        if (kr!=1 || kc!=1 || sr!=1 || sc!=1 || padrt!=0 || padrb!=0 || padcl!=0 || padcr!=0 || groups!=1)
+            msg("The direct algorithm needs 1x1 kernels, stride 1, no padding and no groups", "ConvolDescriptor::set_cpu_algo");
+    } else if (algo==CONV_ALGO_WINOGRAD_2X2 || algo==CONV_ALGO_WINOGRAD_4X4) {
+        if (kr!=3 || kc!=3 || sr!=1 || sc!=1 || dr!=1 || dc!=1 || groups!=1)
+            msg("Winograd needs 3x3 kernels, stride 1, no dilation and no groups", "ConvolDescriptor::set_cpu_algo");
+    } else if (algo==CONV_ALGO_DEPTHWISE) {
+        if (kz!=1)
+            msg("The depthwise algorithm needs one input channel per group", "ConvolDescriptor::set_cpu_algo");
+    } else if (algo!=CONV_ALGO_IM2COL) {
+        msg("Unknown convolution algorithm", "ConvolDescriptor::set_cpu_algo");
+    }
+
+    if (ws!=nullptr && ws->owner==this) ws->owner=nullptr;
+    cpu_algo=algo;
+}
+
+// CPU convolutions of a net share w. With mem 0 the whole batch is lowered
+// (and kept for the gradient while no other layer uses w), with 1 one sample
+// per thread and with 2 CONV_TILE_ROWS output pixels per thread
+void ConvolDescriptor::set_workspace(ConvolWorkspace *w, int mem) {
+    if (own_ws) delete ws;
+    ws=w;
+    own_ws=false;
+    mem_level=mem;
+}
+
+int ConvolDescriptor::lowering_rows() {
+    if (mem_level>1) return std::min(r*c, CONV_TILE_ROWS);
+    return r*c;
+}
+
+// Reserves the lowering buffer for the current batch: at least one slot of
+// lowering_rows() rows per thread, all the batch with mem_level 0. A slot
+// holds the lowering of every group, one after the other
+float *ConvolDescriptor::workspace() {
+    if (ws==nullptr) {
+        ws=new ConvolWorkspace();
+        own_ws=true;
+    }
+#ifdef _OPENMP
+    size_t slots=omp_get_max_threads();
+#else
+    size_t slots=1;
+#endif
+    if (mem_level==0) slots=std::max(slots, (size_t)O->shape[0]);
+    return ws->reserve(slots * lowering_rows() * kr * kc * iz);
+}
+
 int ConvolDescriptor::compute_output(const string& padding, int input_size, int kerkel_size, int stride, int dilation_rate){
     if (padding=="same" || padding =="zeros") {
         return std::ceil((float)input_size/(float)stride);
@@ -10,6 +10,7 @@
 
 
 #include "eddl/descriptors/tensor_descriptors.h"
+#include "eddl/tensor/tensor.h"
 #include "eddl/utils.h"
 
 PermuteDescriptor::PermuteDescriptor(const vector<int>& dims, int dev) : SelDescriptor(dev) {
@@ -39,6 +40,9 @@ void PermuteDescriptor::build_indices(){
     // Delete previous allocations
     this->free_memory();
 
+    // CPU permutes compute the addresses from the strides
+    if (this->device==DEV_CPU) return;
+
     // Compute index translation (output=>input)
     this->cpu_addresses = permute_indices(this->ishape, this->dims);
 }
@@ -45,6 +45,7 @@ PoolDescriptor::PoolDescriptor(const vector<int> &ks, const vector<int> &st, con
 PoolDescriptor::~PoolDescriptor(){
     delete indX;
     delete indY;
+    delete[] indI;
 }
 
 void PoolDescriptor::build(Tensor *A) {
@@ -92,6 +93,12 @@ void PoolDescriptor::build(Tensor *A) {
     O = new Tensor(vector<int>{A->shape[0], z, r, c}, A->device);
 //    if (!mem_level) { D = new Tensor(O->shape, A->device); }
 
+    // Argmax indexes for the CPU kernels (the FPGA emulation also uses them)
+    if (!A->isGPU()) {
+        delete[] indI;
+        indI = new int[O->size];
+    }
+
 
     // Careful with the "size++" not "useless loop"
     size=0;
@@ -105,4 +112,9 @@ void PoolDescriptor::resize(int b) {
 
   O->resize(b);
 //  if (!mem_level) { D->resize(b); }
+
+  if (indI != nullptr) {
+      delete[] indI;
+      indI = new int[O->size];
+  }
 }
@@ -0,0 +1,126 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <cfloat>
+
+#include "eddl/descriptors/descriptors.h"
+#include "eddl/hardware/cpu/cpu_half.h"
+
+
+// K is {nout,...} (conv kernels) or, with channels_last, {nin,nout} (dense)
+QuantDescriptor::QuantDescriptor(Tensor *K, bool channels_last, int dtype) {
+    if (!K->isCPU()) msg("Only implemented for CPU", "QuantDescriptor");
+    if ((dtype != DTYPE_INT8) && (dtype != DTYPE_BFLOAT16) && (dtype != DTYPE_FLOAT16))
+        msg("Only int8, bfloat16 and float16 weights are supported", "QuantDescriptor");
+
+    this->dtype = dtype;
+    nout = (channels_last) ? K->shape[K->ndim-1] : K->shape[0];
+    nin = K->size / nout;
+    npad = ((nout + QUANT_BLOCK - 1) / QUANT_BLOCK) * QUANT_BLOCK;
+
+    in_min = FLT_MAX;
+    in_max = -FLT_MAX;
+    in_scale = 1.0f;
+    in_zero = 0;
+
+    W = nullptr;
+    wscale = nullptr;
+    H = nullptr;
+
+    if (dtype != DTYPE_INT8) {
+        H = new uint16_t[(size_t)npad * nin];
+        memset(H, 0, (size_t)npad * nin * sizeof(uint16_t));
+
+        #pragma omp parallel for
+        for (int c = 0; c < nout; c++) {
+            size_t is = (channels_last) ? nout : 1;
+            const float *k = K->ptr + ((channels_last) ? c : (size_t)c * nin);
+            uint16_t *h = H + (size_t)c * nin;
+            for (int i = 0; i < nin; i++)
+                h[i] = (dtype == DTYPE_BFLOAT16) ? float_to_bf16(k[i * is]) : float_to_fp16(k[i * is]);
+        }
+        return;
+    }
+
+    W = new int8_t[(size_t)npad * nin];
+    wscale = new float[nout];
+    memset(W, 0, (size_t)npad * nin);
+
+    #pragma omp parallel for
+    for (int c = 0; c < nout; c++) {
+        size_t is = (channels_last) ? nout : 1;
+        const float *k = K->ptr + ((channels_last) ? c : (size_t)c * nin);
+
+        float amax = 0.0f;
+        for (int i = 0; i < nin; i++) amax = std::max(amax, std::fabs(k[i * is]));
+        wscale[c] = (amax > 0.0f) ? amax / 127.0f : 1.0f;
+
+        int8_t *w = W + (size_t)c * nin;
+        for (int i = 0; i < nin; i++)
+            w[i] = (int8_t)std::lrint(std::max(-127.0f, std::min(127.0f, k[i * is] / wscale[c])));
+    }
+}
+
+QuantDescriptor::~QuantDescriptor() {
+    delete[] W;
+    delete[] wscale;
+    delete[] H;
+}
+
+// Widens the input range with the values of A
+void QuantDescriptor::calibrate(Tensor *A) {
+    if (!A->isCPU()) msg("Only implemented for CPU", "QuantDescriptor::calibrate");
+
+    float mn = in_min, mx = in_max;
+    #pragma omp parallel for reduction(min:mn) reduction(max:mx)
+    for (int i = 0; i < A->size; i++) {
+        mn = std::min(mn, A->ptr[i]);
+        mx = std::max(mx, A->ptr[i]);
+    }
+    in_min = mn;
+    in_max = mx;
+}
+
+// The range always contains 0, so zero padding is exact
+void QuantDescriptor::set_range() {
+    float lo = std::min(in_min, 0.0f);
+    float hi = std::max(in_max, 0.0f);
+
+    in_scale = (hi > lo) ? (hi - lo) / 255.0f : 1.0f;
+    in_zero = (int)std::lrint(-lo / in_scale);
+}
+
+// Multiplies the weights of each output channel by s (a BatchNorm folded
+// without the float weights, see Net::quantize). int8 weights are symmetric,
+// so a negative factor just flips their sign
+void QuantDescriptor::scale(const vector<float> &s) {
+    #pragma omp parallel for
+    for (int c = 0; c < nout; c++) {
+        if (dtype != DTYPE_INT8) {
+            uint16_t *h = H + (size_t)c * nin;
+            for (int i = 0; i < nin; i++)
+                h[i] = (dtype == DTYPE_BFLOAT16) ? float_to_bf16(bf16_to_float(h[i]) * s[c]) : float_to_fp16(fp16_to_float(h[i]) * s[c]);
+            continue;
+        }
+
+        if (s[c] < 0.0f) {
+            int8_t *w = W + (size_t)c * nin;
+            for (int i = 0; i < nin; i++) w[i] = -w[i];
+        }
+        wscale[c] *= std::fabs(s[c]);
+    }
+}
+
+size_t QuantDescriptor::bytes() {
+    if (dtype != DTYPE_INT8) return (size_t)npad * nin * sizeof(uint16_t);
+    return (size_t)npad * nin + nout * sizeof(float);
+}
@@ -82,7 +82,8 @@ ReduceDescriptor::ReduceDescriptor(Tensor *A, vector<int> axis, string mode, boo
    S=new Tensor(os,dev);
   else S=nullptr;
 
-  build_index();
+  build_plan();
+  if (!A->isCPU()) build_index();
 
 }
 
@@ -140,6 +141,54 @@ void ReduceDescriptor::build_index() {
 }
 
 
+void ReduceDescriptor::build_plan() {
+  // Merge consecutive dims of the same kind (size 1 dims are dropped), so a
+  // reduction is a few nested strided loops with a contiguous inner one
+  vector<int> dshape, dstride, dred;
+  for(int i=0;i<I->ndim;i++) {
+      if (I->shape[i]==1) continue;
+      bool red = find(axis.begin(), axis.end(), i) != axis.end();
+      int n=dshape.size();
+      if ((n>0)&&(dred[n-1]==red)&&(dstride[n-1]==I->shape[i]*I->stride[i])) {
+          dshape[n-1]*=I->shape[i];
+          dstride[n-1]=I->stride[i];
+      }
+      else {
+          dshape.push_back(I->shape[i]);
+          dstride.push_back(I->stride[i]);
+          dred.push_back(red);
+      }
+  }
+  if (dshape.empty()) { dshape.push_back(1); dstride.push_back(1); dred.push_back(false); }
+
+  int last=dshape.size()-1;
+  inner=dshape[last];
+  inner_red=dred[last];
+
+  kshape.clear();
+  kstride.clear();
+  roff.assign(1,0);
+  groups=1;
+  group_size=1;
+  for(int i=0;i<dshape.size();i++) {
+      if (dred[i]) {
+          group_size*=dshape[i];
+          if (i==last) break;
+          vector<int> r;
+          for(int j=0;j<roff.size();j++)
+              for(int k=0;k<dshape[i];k++)
+                  r.push_back(roff[j]+k*dstride[i]);
+          roff=r;
+      }
+      else {
+          groups*=dshape[i];
+          kshape.push_back(dshape[i]);
+          kstride.push_back(dstride[i]);
+      }
+  }
+}
+
+
 void ReduceDescriptor::resize(int b)
 {
   int i;
@@ -156,7 +205,8 @@ void ReduceDescriptor::resize(int b)
       S->resize(b);
   }
   ind=nullptr;
-  build_index();
+  build_plan();
+  if (!I->isCPU()) build_index();
 }
 
 
@@ -0,0 +1,222 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+#include "eddl/system_info.h"
+#include "eddl/utils.h"
+#include "eddl/hardware/cpu/cpu_allocator.h"
+
+#ifdef EDDL_WINDOWS
+#include <malloc.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+struct CPUPool {
+    std::mutex mtx;
+    std::map<size_t, std::vector<void *>> free_blocks;  // bucket size -> cached blocks
+    std::unordered_map<void *, size_t> live;              // pointer -> bucket size
+    std::unordered_map<void *, std::pair<void *, size_t>> mapped;  // pointer -> file mapping (base, length)
+    size_t limit = CPU_POOL_DEFAULT_LIMIT;
+    CPUPoolStats stats = {0, 0, 0, 0, 0, 0};
+};
+
+static void release_at_exit(){
+    cpu_pool_set_limit(0);
+}
+
+// Never destroyed: tensors living in static storage may be freed after main
+// returns. At exit the cached blocks go back to the system, and so do the
+// blocks freed after that
+static CPUPool &get_pool(){
+    static CPUPool *pool = [](){ std::atexit(release_at_exit); return new CPUPool(); }();
+    return *pool;
+}
+
+// Round up to the alignment for small requests and to a quarter of the
+// enclosing power of two for the rest (at most 25% of wasted memory)
+static size_t bucket_size(size_t bytes){
+    if (bytes <= 4 * CPU_POOL_ALIGNMENT) {
+        return ((bytes + CPU_POOL_ALIGNMENT - 1) / CPU_POOL_ALIGNMENT) * CPU_POOL_ALIGNMENT;
+    }
+
+    size_t p = 1;
+    while ((p << 1) <= bytes) p <<= 1;
+    size_t step = p >> 2;
+    return ((bytes + step - 1) / step) * step;
+}
+
+static void *system_alloc(size_t bytes){
+    void *ptr = nullptr;
+#ifdef EDDL_WINDOWS
+    ptr = _aligned_malloc(bytes, CPU_POOL_ALIGNMENT);
+#else
+    if (posix_memalign(&ptr, CPU_POOL_ALIGNMENT, bytes) != 0) ptr = nullptr;
+#endif
+    return ptr;
+}
+
+static void system_free(void *ptr){
+#ifdef EDDL_WINDOWS
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+// Caller must hold the lock
+static void release_cached(CPUPool &pool, size_t keep_bytes){
+    auto it = pool.free_blocks.end();
+    while (pool.stats.cached > keep_bytes && it != pool.free_blocks.begin()) {
+        --it;  // Biggest blocks first
+        while (!it->second.empty() && pool.stats.cached > keep_bytes) {
+            system_free(it->second.back());
+            it->second.pop_back();
+            pool.stats.cached -= it->first;
+            pool.stats.releases++;
+        }
+    }
+}
+
+void *cpu_pool_alloc(size_t bytes){
+    CPUPool &pool = get_pool();
+    size_t bsize = bucket_size(bytes);
+
+    {
+        std::lock_guard<std::mutex> lock(pool.mtx);
+        auto it = pool.free_blocks.find(bsize);
+        if (it != pool.free_blocks.end() && !it->second.empty()) {
+            void *ptr = it->second.back();
+            it->second.pop_back();
+            pool.stats.cached -= bsize;
+            pool.stats.in_use += bsize;
+            if (pool.stats.in_use > pool.stats.peak) pool.stats.peak = pool.stats.in_use;
+            pool.stats.hits++;
+            pool.live[ptr] = bsize;
+            return ptr;
+        }
+    }
+
+    // Miss: go to the system. Cached blocks of other sizes are given back before failing
+    void *ptr = system_alloc(bsize);
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    if (ptr == nullptr && pool.stats.cached > 0) {
+        release_cached(pool, 0);
+        ptr = system_alloc(bsize);
+    }
+    if (ptr == nullptr) return nullptr;
+
+    pool.stats.in_use += bsize;
+    if (pool.stats.in_use > pool.stats.peak) pool.stats.peak = pool.stats.in_use;
+    pool.stats.misses++;
+    pool.live[ptr] = bsize;
+    return ptr;
+}
+
+void cpu_pool_free(void *ptr){
+    if (ptr == nullptr) return;
+
+    CPUPool &pool = get_pool();
+    size_t bsize;
+    {
+        std::lock_guard<std::mutex> lock(pool.mtx);
+        auto it = pool.live.find(ptr);
+        if (it != pool.live.end()) {
+            bsize = it->second;
+            pool.live.erase(it);
+            pool.stats.in_use -= bsize;
+
+            if (pool.stats.cached + bsize <= pool.limit) {
+                pool.free_blocks[bsize].push_back(ptr);
+                pool.stats.cached += bsize;
+                return;
+            }
+            pool.stats.releases++;
+        }
+        else {
+            bsize = 0;
+
+            auto m = pool.mapped.find(ptr);
+            if (m != pool.mapped.end()) {
+#ifndef EDDL_WINDOWS
+                munmap(m->second.first, m->second.second);
+#endif
+                pool.mapped.erase(m);
+                return;
+            }
+        }
+    }
+
+    if (bsize) system_free(ptr);
+    else delete[] (float *)ptr;  // Buffer allocated outside the pool (and owned by a tensor)
+}
+
+bool cpu_pool_owns(void *ptr){
+    CPUPool &pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    return pool.live.find(ptr) != pool.live.end();
+}
+
+void cpu_pool_trim(size_t keep_bytes){
+    CPUPool &pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    release_cached(pool, keep_bytes);
+}
+
+void cpu_pool_set_limit(size_t bytes){
+    CPUPool &pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    pool.limit = bytes;
+    release_cached(pool, bytes);
+}
+
+CPUPoolStats cpu_pool_stats(){
+    CPUPool &pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    return pool.stats;
+}
+
+void cpu_pool_show_stats(){
+    CPUPoolStats s = cpu_pool_stats();
+    printf("CPU memory pool:\n");
+    printf("  in use:   %s (peak %s)\n", bytes2human(s.in_use).c_str(), bytes2human(s.peak).c_str());
+    printf("  cached:   %s\n", bytes2human(s.cached).c_str());
+    printf("  requests: %llu hits, %llu misses, %llu releases\n", s.hits, s.misses, s.releases);
+}
+
+void *cpu_map_file(const char *filename, size_t offset, size_t bytes, bool sequential){
+#ifdef EDDL_WINDOWS
+    return nullptr;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    // The whole prefix is mapped so the base stays page aligned
+    size_t length = offset + bytes;
+    void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps its own reference
+    if (base == MAP_FAILED) return nullptr;
+
+    madvise(base, length, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+
+    void *ptr = (char *)base + offset;
+    CPUPool &pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    pool.mapped[ptr] = std::make_pair(base, length);
+    return ptr;
+#endif
+}
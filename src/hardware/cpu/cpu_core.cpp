@@ -10,28 +10,12 @@
 #include "eddl/hardware/cpu/cpu_tensor.h"
 #include <algorithm>
 #include <numeric>
+#include <cstring>
 
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
+#include <chrono>
+#include <map>
+#include <mutex>
 
-    #include <chrono>
-    #include <windows.h>
-    #include <winsock.h>
-
-    int gettimeofday(struct timeval* tp, struct timezone* tzp)
-    {
-        namespace sc = std::chrono;
-        sc::system_clock::duration d = sc::system_clock::now().time_since_epoch();
-        sc::seconds s = sc::duration_cast<sc::seconds>(d);
-        tp->tv_sec = s.count();
-        tp->tv_usec = sc::duration_cast<sc::microseconds>(d - s).count();
-
-        return 0;
-    }
-#else
-    #include <sys/time.h>
-#endif
-
-int num_instances[_NUM_CPU_FUNCS];
 float mb_memory_needed;
 
 void _profile_funcname(int i, char *name) {
@@ -182,36 +166,265 @@ case _CPU_AVGPOOL2D              : strcpy(name, "avgpool2d"); break;
 case _CPU_AVGPOOL2D_BACK         : strcpy(name, "avgpool2d_back"); break;
 case _CPU_REPEAT_NN              : strcpy(name, "repeat_nn"); break;
 case _CPU_D_REPEAT_NN            : strcpy(name, "d_repeat_nn"); break;
+case _CPU_ADAM                   : strcpy(name, "adam"); break;
+case _CPU_SOFT_CENT              : strcpy(name, "soft_cent"); break;
+case _CPU_LSTM_PACK              : strcpy(name, "lstm_pack"); break;
+case _CPU_LSTM_CELL              : strcpy(name, "lstm_cell"); break;
+case _CPU_D_LSTM_CELL            : strcpy(name, "d_lstm_cell"); break;
+case _CPU_LSTM_GRAD              : strcpy(name, "lstm_grad"); break;
+case _CPU_BN_FORWARD             : strcpy(name, "bn_forward"); break;
+case _CPU_BN_BACKWARD            : strcpy(name, "bn_backward"); break;
+case _CPU_BIAS_ACT               : strcpy(name, "bias_act"); break;
+case _CPU_PERMUTE                : strcpy(name, "permute"); break;
+case _CPU_AFFINE_RANDOM          : strcpy(name, "affine_random"); break;
+case _CPU_ZERO_ROWS              : strcpy(name, "zero_rows"); break;
+case _CPU_SGD_ROWS               : strcpy(name, "sgd_rows"); break;
+case _CPU_ADAM_ROWS              : strcpy(name, "adam_rows"); break;
+case _CPU_RMSPROP_ROWS           : strcpy(name, "rmsprop_rows"); break;
+case _CPU_QDENSE                 : strcpy(name, "qdense"); break;
+case _CPU_QCONV2D                : strcpy(name, "qconv2D"); break;
+case _CPU_CONV2DT                : strcpy(name, "conv2DT"); break;
+case _CPU_CONV2DT_GRAD           : strcpy(name, "conv2DT_grad"); break;
+case _CPU_CONV2DT_BACK           : strcpy(name, "conv2DT_back"); break;
 default                          : strcpy(name, "?????"); break;
 }
 }
 
-struct timeval time_ini[_NUM_CPU_FUNCS];
-unsigned long long acc_time[_NUM_CPU_FUNCS];
+/////////////////////////////////////////
+//// RUNTIME PROFILER
+// Every thread records into its own buffer, under its own lock (only
+// contended while the profile is reset, shown or exported). Kernels are
+// identified by their _CPU_* id; scopes (layers) by name and category.
+// Buffers are merged when the profile is shown or exported.
+std::atomic<bool> _profile_enabled(false);
+static std::atomic<bool> _profile_tracing(false);
+static std::atomic<long long> _profile_t0(0);
+static std::mutex _profile_mtx;  // _profile_threads
+
+struct ProfileEvent {
+    int id;          // _CPU_* id, or -1 for named scopes
+    string name;     // Only for scopes
+    string cat;
+    long long ts;    // ns since the profiler was enabled
+    long long dur;   // ns
+};
+
+struct ProfileOpen {
+    int id;
+    string name;
+    string cat;
+    long long ts;
+};
+
+struct ProfileScopeStats {
+    unsigned long long calls;
+    long long ns;
+};
+
+struct ProfileThread {
+    std::mutex mtx;
+    int tid;
+    vector<ProfileOpen> stack;
+    unsigned long long calls[_NUM_CPU_FUNCS];
+    long long ns[_NUM_CPU_FUNCS];
+    map<pair<string, string>, ProfileScopeStats> scopes;  // (name, category)
+    vector<ProfileEvent> events;
+    unsigned long long dropped;
+};
+
+static vector<ProfileThread *> _profile_threads;
+
+static long long _profile_now(){
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static ProfileThread *_profile_thread(){
+    static thread_local ProfileThread *pt = nullptr;
+    if (pt == nullptr) {
+        pt = new ProfileThread();
+        std::fill(pt->calls, pt->calls + _NUM_CPU_FUNCS, 0);
+        std::fill(pt->ns, pt->ns + _NUM_CPU_FUNCS, 0);
+        pt->dropped = 0;
+
+        std::lock_guard<std::mutex> lock(_profile_mtx);
+        pt->tid = (int)_profile_threads.size();
+        _profile_threads.push_back(pt);
+    }
+    return pt;
+}
+
+static void _profile_record(ProfileThread *pt, int id, const string &name, const string &cat, long long ts, long long dur){
+    if (!_profile_tracing) return;
+    if (pt->events.size() >= _PROFILE_MAX_EVENTS) { pt->dropped++; return; }
+    pt->events.push_back({id, name, cat, ts, dur});
+}
 
 void _profile(int f_id, int end) {
-  num_instances[f_id]++;
-  if (!end) gettimeofday(&time_ini[f_id], NULL);
+  if (!_profile_enabled) return;
+
+  ProfileThread *pt = _profile_thread();
+  std::lock_guard<std::mutex> lock(pt->mtx);
+  long long t = _profile_now() - _profile_t0;
+  if (!end) {
+      pt->stack.push_back({f_id, "", "", t});
+  }
   else {
-      timeval t1;
-      gettimeofday(&t1, NULL);
-      acc_time[f_id] += ((t1.tv_sec - time_ini[f_id].tv_sec) * 1000000) +
-                        (t1.tv_usec - time_ini[f_id].tv_usec);
+      // Close the innermost scope opened by this kernel (skips unbalanced ones)
+      while (!pt->stack.empty()) {
+          ProfileOpen o = pt->stack.back();
+          pt->stack.pop_back();
+          if (o.id == f_id) {
+              pt->calls[f_id]++;
+              pt->ns[f_id] += t - o.ts;
+              _profile_record(pt, f_id, "", "kernel", o.ts, t - o.ts);
+              break;
+          }
+      }
+  }
+}
+
+void _profile_scope_begin(const string &name, const string &cat){
+  if (!_profile_enabled) return;
+
+  ProfileThread *pt = _profile_thread();
+  std::lock_guard<std::mutex> lock(pt->mtx);
+  pt->stack.push_back({-1, name, cat, _profile_now() - _profile_t0});
+}
+
+void _profile_scope_end(){
+  if (!_profile_enabled) return;
+
+  ProfileThread *pt = _profile_thread();
+  std::lock_guard<std::mutex> lock(pt->mtx);
+  long long t = _profile_now() - _profile_t0;
+  while (!pt->stack.empty()) {
+      ProfileOpen o = pt->stack.back();
+      pt->stack.pop_back();
+      if (o.id == -1) {
+          ProfileScopeStats &s = pt->scopes[make_pair(o.name, o.cat)];
+          s.calls++;
+          s.ns += t - o.ts;
+          _profile_record(pt, -1, o.name, o.cat, o.ts, t - o.ts);
+          break;
+      }
+  }
+}
+
+void _profile_enable(bool trace){
+  std::lock_guard<std::mutex> lock(_profile_mtx);
+  if (!_profile_enabled) _profile_t0 = _profile_now();
+  _profile_tracing = trace;
+  _profile_enabled = true;
+}
+
+void _profile_disable(){
+  _profile_enabled = false;
+}
+
+void _profile_reset(){
+  std::lock_guard<std::mutex> lock(_profile_mtx);
+  for (auto pt : _profile_threads) {
+      std::lock_guard<std::mutex> tlock(pt->mtx);
+      std::fill(pt->calls, pt->calls + _NUM_CPU_FUNCS, 0);
+      std::fill(pt->ns, pt->ns + _NUM_CPU_FUNCS, 0);
+      pt->scopes.clear();
+      pt->events.clear();
+      pt->dropped = 0;
+      pt->stack.clear();  // scopes still open began before the new t0, they are not recorded
   }
+  _profile_t0 = _profile_now();
 }
 
 void _show_profile() {
-  #ifdef CPU_DEBUG
+  std::lock_guard<std::mutex> lock(_profile_mtx);
+
+  // Merge the per-thread buffers
+  unsigned long long calls[_NUM_CPU_FUNCS] = {0};
+  long long ns[_NUM_CPU_FUNCS] = {0};
+  map<pair<string, string>, ProfileScopeStats> scopes;
+  long long scopes_total = 0;
+  for (auto pt : _profile_threads) {
+      std::lock_guard<std::mutex> tlock(pt->mtx);
+      for (int i = 0; i < _NUM_CPU_FUNCS; i++) {
+          calls[i] += pt->calls[i];
+          ns[i] += pt->ns[i];
+      }
+      for (auto &s : pt->scopes) {
+          ProfileScopeStats &d = scopes[s.first];
+          d.calls += s.second.calls;
+          d.ns += s.second.ns;
+          scopes_total += s.second.ns;
+      }
+  }
+
   printf("\nCPU functions called:\n");
   for (int i=0; i<_NUM_CPU_FUNCS; i++) {
-    if (num_instances[i] != 0) {
+    if (calls[i] != 0) {
       char func_name[50];
       _profile_funcname(i, func_name);
-      printf("%-50s: %d instances, %llu us\n", func_name, num_instances[i], acc_time[i]);
+      printf("%-50s: %llu instances, %.3f ms\n", func_name, calls[i], ns[i] / 1e6);
     }
   }
+
+  if (!scopes.empty()) {
+      vector<pair<pair<string, string>, ProfileScopeStats>> rows(scopes.begin(), scopes.end());
+      std::sort(rows.begin(), rows.end(), [](const pair<pair<string, string>, ProfileScopeStats> &a,
+                                             const pair<pair<string, string>, ProfileScopeStats> &b) {
+          return a.second.ns > b.second.ns;
+      });
+
+      printf("\nLayers:\n");
+      printf("%-30s %-10s %10s %12s %12s %7s\n", "layer", "phase", "calls", "total (ms)", "avg (ms)", "%");
+      for (auto &r : rows) {
+          printf("%-30s %-10s %10llu %12.3f %12.3f %6.2f%%\n", r.first.first.c_str(), r.first.second.c_str(),
+                 r.second.calls, r.second.ns / 1e6, r.second.ns / 1e6 / r.second.calls,
+                 scopes_total ? 100.0 * r.second.ns / scopes_total : 0.0);
+      }
+  }
   printf("Memory: %f MB\n", mb_memory_needed);
-  #endif
+}
+
+static string _profile_json_escape(const string &s){
+  string r;
+  for (char ch : s) {
+      if (ch == '"' || ch == '\\') { r += '\\'; r += ch; }
+      else if ((unsigned char)ch < 0x20) r += ' ';
+      else r += ch;
+  }
+  return r;
+}
+
+void _profile_export_trace(const string &fname){
+  std::lock_guard<std::mutex> lock(_profile_mtx);
+
+  FILE *fe = fopen(fname.c_str(), "w");
+  if (fe == nullptr) msg("Unable to open " + fname, "_profile_export_trace");
+
+  // Chrome trace format (chrome://tracing, Perfetto): complete events, times in us
+  fprintf(fe, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  bool first = true;
+  unsigned long long dropped = 0;
+  for (auto pt : _profile_threads) {
+      std::lock_guard<std::mutex> tlock(pt->mtx);
+      dropped += pt->dropped;
+      for (auto &e : pt->events) {
+          string name = e.name;
+          if (e.id >= 0) {
+              char func_name[50];
+              _profile_funcname(e.id, func_name);
+              name = func_name;
+          }
+          fprintf(fe, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d}",
+                  first ? "" : ",\n", _profile_json_escape(name).c_str(), _profile_json_escape(e.cat).c_str(),
+                  e.ts / 1e3, e.dur / 1e3, pt->tid);
+          first = false;
+      }
+  }
+  fprintf(fe, "\n]}\n");
+  fclose(fe);
+
+  if (dropped) fprintf(stderr, "Profiler: %llu events were dropped (buffer full)\n", dropped);
 }
 
 void _profile_add_tensor(long size) {
@@ -242,6 +455,141 @@ void cpu_copy(Tensor * A, Tensor * B){
     _profile(_CPU_COPY, 1);
 }
 
+#define PERMUTE_TILE 32
+
+// Permutation plan: output dims (size>1) with their input strides, merging the
+// output dims that are also consecutive in the input
+struct permute_plan {
+    vector<int> size, istride, ostride;
+};
+
+static permute_plan permute_build(const vector<int>& shape, const vector<int>& dims){
+    permute_plan p;
+    vector<int> stride(shape.size());
+    int s=1;
+    for(int i=shape.size()-1;i>=0;i--) { stride[i]=s; s*=shape[i]; }
+
+    for(int k=0;k<dims.size();k++) {
+        int d=dims[k];
+        if (shape[d]==1) continue;
+        if ((!p.size.empty())&&(p.istride.back()==shape[d]*stride[d])) {
+            p.size.back()*=shape[d];
+            p.istride.back()=stride[d];
+        }
+        else {
+            p.size.push_back(shape[d]);
+            p.istride.push_back(stride[d]);
+        }
+    }
+
+    int m=p.size.size();
+    p.ostride.resize(m);
+    s=1;
+    for(int k=m-1;k>=0;k--) { p.ostride[k]=s; s*=p.size[k]; }
+    return p;
+}
+
+// Input/output offsets of the i-th element of the dims not in {a,b}
+static inline void permute_offsets(const permute_plan& p, int i, int a, int b, int& ioff, int& ooff){
+    ioff=ooff=0;
+    for(int k=p.size.size()-1;k>=0;k--) {
+        if ((k==a)||(k==b)) continue;
+        int c=i%p.size[k];
+        i/=p.size[k];
+        ioff+=c*p.istride[k];
+        ooff+=c*p.ostride[k];
+    }
+}
+
+void cpu_permute(Tensor *A, Tensor *B, const vector<int>& dims, int inc){
+    _profile(_CPU_PERMUTE, 0);
+    permute_plan p=permute_build(A->shape,dims);
+    int m=p.size.size();
+    float *src=A->ptr;
+    float *dst=B->ptr;
+
+    if ((m==0)||(p.istride[m-1]==1)) {
+        // Contiguous rows in both tensors
+        int row=(m==0) ? 1 : p.size[m-1];
+        int rows=A->size/row;
+
+        #pragma omp parallel for
+        for(int r=0;r<rows;r++) {
+            int ioff, ooff;
+            permute_offsets(p,r,m-1,m-1,ioff,ooff);
+            if (inc) {
+                float *d=dst+ooff;
+                const float *s=src+ioff;
+                #pragma omp simd
+                for(int j=0;j<row;j++) d[j]+=s[j];
+            }
+            else memcpy(dst+ooff,src+ioff,row*sizeof(float));
+        }
+    }
+    else {
+        // 2D transpose of the output inner dim (a) with the input inner dim (b)
+        int a=m-1, b=0;
+        while (p.istride[b]!=1) b++;
+        int na=p.size[a], sa=p.istride[a];
+        int nb=p.size[b], sb=p.ostride[b];
+        int ta=(na+PERMUTE_TILE-1)/PERMUTE_TILE;
+        int tb=(nb+PERMUTE_TILE-1)/PERMUTE_TILE;
+        int outer=A->size/(na*nb);
+
+        #pragma omp parallel for
+        for(int t=0;t<outer*ta*tb;t++) {
+            int ioff, ooff;
+            permute_offsets(p,t/(ta*tb),a,b,ioff,ooff);
+            int a0=((t/tb)%ta)*PERMUTE_TILE, a1=std::min(a0+PERMUTE_TILE,na);
+            int b0=(t%tb)*PERMUTE_TILE, b1=std::min(b0+PERMUTE_TILE,nb);
+
+            for(int j=b0;j<b1;j++) {
+                float *d=dst+ooff+j*sb;
+                const float *s=src+ioff+j;
+                if (inc)
+                    for(int i=a0;i<a1;i++) d[i]+=s[i*sa];
+                else
+                    for(int i=a0;i<a1;i++) d[i]=s[i*sa];
+            }
+        }
+    }
+    _profile(_CPU_PERMUTE, 1);
+}
+
+bool cpu_permute_(Tensor *A, const vector<int>& dims){
+    permute_plan p=permute_build(A->shape,dims);
+    int m=p.size.size();
+
+    // Same memory layout
+    if (m<=1) return true;
+
+    // Square matrices transposed in place, with an optional outer dim kept
+    int o=m-2;
+    int n=p.size[m-1];
+    if ((m>3)||(p.size[o]!=n)||(p.istride[m-1]!=n)||(p.istride[o]!=1)) return false;
+    if ((m==3)&&(p.istride[0]!=n*n)) return false;
+
+    _profile(_CPU_PERMUTE, 0);
+    int mats=A->size/(n*n);
+    int tn=(n+PERMUTE_TILE-1)/PERMUTE_TILE;
+
+    // Tiles (ti,tj) with tj>=ti, swapped with their mirror
+    #pragma omp parallel for
+    for(int t=0;t<mats*tn*tn;t++) {
+        int ti=(t/tn)%tn, tj=t%tn;
+        if (tj<ti) continue;
+        float *ptr=A->ptr+(t/(tn*tn))*n*n;
+        int i0=ti*PERMUTE_TILE, i1=std::min(i0+PERMUTE_TILE,n);
+        int j0=tj*PERMUTE_TILE, j1=std::min(j0+PERMUTE_TILE,n);
+
+        for(int i=i0;i<i1;i++)
+            for(int j=(ti==tj) ? i+1 : j0;j<j1;j++)
+                std::swap(ptr[i*n+j],ptr[j*n+i]);
+    }
+    _profile(_CPU_PERMUTE, 1);
+    return true;
+}
+
 void cpu_fill_(Tensor *A, float v){
     _profile(_CPU_FILL_, 0);
     #pragma omp parallel for
@@ -332,46 +680,68 @@ void cpu_deselect(Tensor * A, Tensor * B, vector<int> sind, int ini, int end,int
     _profile(_CPU_DESELECT, 0);
     int s = A->size / A->shape[0];
 
+    // Rows of A grouped by destination: a repeated index (e.g. the same word
+    // twice in a batch) is written by one thread only, in the original order
+    vector<int> order(end - ini);
+    std::iota(order.begin(), order.end(), ini);
+    std::stable_sort(order.begin(), order.end(), [&sind](int a, int b) { return sind[a] < sind[b]; });
+
+    vector<int> first;
+    for (int k = 0; k < order.size(); k++)
+        if ((k == 0) || (sind[order[k]] != sind[order[k - 1]])) first.push_back(k);
+    first.push_back(order.size());
+
 #pragma omp parallel for
-    for (int i = ini; i < end; i++) {
-        int p  = sind[i] * s;
-        int pb = (i - ini) * s;
-        for (int j = 0; j < s; j++, p++, pb++)
-            if ((mask_zeros)&&(sind[i]==0)) B->ptr[p]=0;
+    for (int g = 0; g < first.size() - 1; g++) {
+        int row = sind[order[first[g]]];
+        float *pb = B->ptr + row * s;
+
+        if ((mask_zeros) && (row == 0)) {
+            std::fill(pb, pb + s, 0.0f);
+            continue;
+        }
+
+        for (int k = first[g]; k < first[g + 1]; k++) {
+            const float *pa = A->ptr + (order[k] - ini) * s;
+            if (!inc) std::copy(pa, pa + s, pb);
             else {
-                if (!inc) B->ptr[p] = A->ptr[pb];
-                else B->ptr[p] += A->ptr[pb];
+                #pragma omp simd
+                for (int j = 0; j < s; j++) pb[j] += pa[j];
             }
+        }
     }
     _profile(_CPU_DESELECT, 1);
 }
 
 void cpu_concat(Tensor *A, vector<Tensor*> t, unsigned int axis, bool derivative){
     _profile(_CPU_CONCAT, 0);
-  // Walk through all the tensors to concat one axis (once)
+    // A is a sequence of blocks, one per index of the dimensions before axis,
+    // and each block holds one contiguous chunk of every tensor
     unsigned int offset = 0;
-    unsigned int src_stride = 0;
     int steps = A->stride[axis] * A->shape[axis];  // Equivalent to A->stride[axis-1], but without the negative index problem
+    int blocks = A->size / steps;
 
     // Walk through each tensor
     for (unsigned int i = 0; i < t.size(); i++) {
-        offset += src_stride;
-        src_stride = t[i]->stride[axis] * t[i]->shape[axis];
-
-        // Copy n bytes from src to dest
+        int chunk = t[i]->stride[axis] * t[i]->shape[axis];
         float *dest = A->ptr + offset;
         float *src = t[i]->ptr;
 
-        // Walk tensor i
-#pragma omp parallel for
-        for (int j = 0; j < t[i]->size; j++) {
-            unsigned int k = j % src_stride;  // Pos (index) in the stride (src)
-            unsigned int stride_idx = j / src_stride;  // Index of the stride (src/dst)
-            unsigned int dest_offset = stride_idx * steps;  // Offset in dest
+        // Already in place (see LConcat)
+        if (src == dest) { offset += chunk; continue; }
 
-            if(derivative){ src[j] += dest[dest_offset + k]; }
-            else{ dest[dest_offset + k] = src[j]; }
+        #pragma omp parallel for if(blocks > 1)
+        for (int b = 0; b < blocks; b++) {
+            float *d = dest + (size_t)b * steps;
+            float *s = src + (size_t)b * chunk;
+
+            if(derivative){
+                #pragma omp simd
+                for (int k = 0; k < chunk; k++) s[k] += d[k];
+            }
+            else std::copy(s, s + chunk, d);
         }
+        offset += chunk;
     }
     _profile(_CPU_CONCAT, 1);
 }
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <utility>
 #include <cmath>
+#include <algorithm>
 
 #include "eddl/hardware/cpu/cpu_tensor.h"
 #include "eddl/random.h"
@@ -55,7 +56,8 @@ void cpu_single_rotate(int b, Tensor *A, Tensor *B, float angle, vector<int> off
     float side_b = A->shape[3]/2.0f;
     int center[2] = {(int)side_a+offset_center[0], (int)side_b+offset_center[1]};
     float angle_rad = (float)((-angle) * M_PI/180.0f);  // Convert to radians
-
+    float sin_a = ::sinf(angle_rad);
+    float cos_a = ::cosf(angle_rad);
 
     for(int c=0; c<B->shape[1]; c++) {
         for (int Bi = 0; Bi < B->shape[2]; Bi++) {
@@ -63,8 +65,8 @@ void cpu_single_rotate(int b, Tensor *A, Tensor *B, float angle, vector<int> off
                 int Bi_c = Bi - center[0];
                 int Bj_c = Bj - center[1];
 
-                int Ai = ::sinf(angle_rad) * Bj_c + ::cosf(angle_rad) * Bi_c + center[0];
-                int Aj = ::cosf(angle_rad) * Bj_c - ::sinf(angle_rad) * Bi_c + center[1];
+                int Ai = sin_a * Bj_c + cos_a * Bi_c + center[0];
+                int Aj = cos_a * Bj_c - sin_a * Bi_c + center[1];
 
                 int B_pos = b*B->stride[0] + c*B->stride[1] + Bi*B->stride[2] + Bj*B->stride[3];
                 if (Ai >= 0 && Ai < A->shape[2] && Aj >= 0 && Aj < A->shape[3]){
@@ -411,3 +413,114 @@ void cpu_cutout_random(Tensor *A, Tensor *B, vector<float> factor_x, vector<floa
     }
     _profile(_CPU_CUTOUT_RANDOM, 0);
 }
+
+
+// Samples plane A (h x w) at (y, x); "orig" is used for the Original mode
+static inline float da_sample(const float *A, int h, int w, float y, float x, bool bilinear, int mode, float constant, float orig){
+    int yn = (int)::floorf(y + 0.5f);
+    int xn = (int)::floorf(x + 0.5f);
+
+    if (yn < 0 || yn >= h || xn < 0 || xn >= w) {
+        if(mode == WrappingMode::Constant) return constant;
+        else if(mode == WrappingMode::Original) return orig;
+        // Nearest: the border is replicated
+    }
+
+    if (!bilinear) {
+        yn = std::min(std::max(yn, 0), h-1);
+        xn = std::min(std::max(xn, 0), w-1);
+        return A[yn*w + xn];
+    }
+
+    int y0 = (int)::floorf(y);
+    int x0 = (int)::floorf(x);
+    float fy = y - y0;
+    float fx = x - x0;
+    int y1 = std::min(std::max(y0+1, 0), h-1); y0 = std::min(std::max(y0, 0), h-1);
+    int x1 = std::min(std::max(x0+1, 0), w-1); x0 = std::min(std::max(x0, 0), w-1);
+
+    float top = A[y0*w + x0] + fx * (A[y0*w + x1] - A[y0*w + x0]);
+    float bottom = A[y1*w + x0] + fx * (A[y1*w + x1] - A[y1*w + x0]);
+    return top + fy * (bottom - top);
+}
+
+void cpu_affine_random(Tensor *A, Tensor *B, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, bool bilinear, int mode, float constant){
+    // Crop-scale, flip, rotation, scale and shift merged into one affine map per
+    // sample (output => input coordinates); the cutout is filled as rows are written
+    if(mode != WrappingMode::Constant && mode != WrappingMode::Original && mode != WrappingMode::Nearest){
+        msg("Mode (" + to_string(mode) + ") not implemented", "Tensor::cpu_affine_random");
+    }
+
+    _profile(_CPU_AFFINE_RANDOM, 0);
+    int batch = B->shape[0];
+    int chans = B->shape[1];
+    int h = B->shape[2];
+    int w = B->shape[3];
+    float cy = (h-1)/2.0f;
+    float cx = (w-1)/2.0f;
+
+    // Parameters are drawn sequentially (reproducible for a given seed). The
+    // crop and cutout only when used, so the other draws do not change
+    bool crop = (crop_scale[0] != 1.0f || crop_scale[1] != 1.0f);
+    bool cutout = (cutout_x[1] > 0.0f && cutout_y[1] > 0.0f);
+    vector<float> M(6*batch);
+    vector<int> C(4*batch, 0);  // cutout rows [C0, C1) x cols [C2, C3)
+    for(int b=0; b<batch; b++) {
+        float angle = (float)((-uniform(rotation[0], rotation[1])) * M_PI/180.0f);
+        float s = uniform(scale[0], scale[1]);
+        float ty = h * uniform(shift_y[0], shift_y[1]);
+        float tx = w * uniform(shift_x[0], shift_x[1]);
+        float fy = 1.0f, fx = 1.0f;
+        if (flip_axis >= 0 && uniform(0.0f, 1.0f) >= 0.5f) {
+            if (flip_axis == 0) fy = -1.0f; else fx = -1.0f;
+        }
+
+        // in = c + L * (out - c - t), with L = F * R^-1 / s
+        float ca = ::cosf(angle) / s;
+        float sa = ::sinf(angle) / s;
+        float *m = &M[6*b];
+        m[0] = fy*ca;  m[1] = fy*sa;
+        m[3] = -fx*sa; m[4] = fx*ca;
+        m[2] = cy - m[0]*(cy+ty) - m[1]*(cx+tx);
+        m[5] = cx - m[3]*(cy+ty) - m[4]*(cx+tx);
+
+        // Crop of a window k times the image, scaled back to the full size:
+        // in = origin + k * out
+        if (crop) {
+            float k = uniform(crop_scale[0], crop_scale[1]);
+            float y0 = (h-1) * (1.0f-k) * uniform(0.0f, 1.0f);
+            float x0 = (w-1) * (1.0f-k) * uniform(0.0f, 1.0f);
+            for(int e=0; e<3; e++) { m[e] *= k; m[3+e] *= k; }
+            m[2] += y0;
+            m[5] += x0;
+        }
+
+        if (cutout) {
+            int ch = (int)(h * uniform(cutout_y[0], cutout_y[1]));
+            int cw = (int)(w * uniform(cutout_x[0], cutout_x[1]));
+            int y = (int)((h-ch) * uniform(0.0f, 1.0f));
+            int x = (int)((w-cw) * uniform(0.0f, 1.0f));
+            int *c = &C[4*b];
+            c[0] = y; c[1] = y+ch; c[2] = x; c[3] = x+cw;
+        }
+    }
+
+    #pragma omp parallel for
+    for(int p=0; p<batch*chans; p++) {
+        const float *m = &M[6*(p/chans)];
+        const int *c = &C[4*(p/chans)];
+        const float *a = A->ptr + p*h*w;
+        float *o = B->ptr + p*h*w;
+
+        for(int i=0; i<h; i++) {
+            float y = m[0]*i + m[2];
+            float x = m[3]*i + m[5];
+            for(int j=0; j<w; j++, y+=m[1], x+=m[4]) {
+                o[i*w + j] = da_sample(a, h, w, y, x, bilinear, mode, constant, a[i*w + j]);
+            }
+            if (i >= c[0] && i < c[1])
+                for(int j=c[2]; j<c[3]; j++) o[i*w + j] = constant;
+        }
+    }
+    _profile(_CPU_AFFINE_RANDOM, 1);
+}
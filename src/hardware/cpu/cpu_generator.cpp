@@ -8,43 +8,92 @@
 */
 
 
+#include <cmath>
+
 #include "eddl/random.h"
 #include "eddl/hardware/cpu/cpu_tensor.h"
 
+// Every block of 4 values comes from one Philox call on counter base+block:
+// parallel, and the same numbers for any number of threads
+
 void cpu_rand_uniform(Tensor * A, float v)
 {
     _profile(_CPU_RAND_UNIFORM, 0);
-#pragma omp parallel for
-    for (int i = 0; i < A->size; ++i) A->ptr[i] = uniform() * v;
+    uint64_t key = get_random_seed();
+    int blocks = (A->size + 3) / 4;
+    uint64_t base = reserve_random_counters(blocks);
+
+    #pragma omp parallel for
+    for (int b = 0; b < blocks; ++b) {
+        uint32_t r[4];
+        philox4x32(base + b, key, r);
+        for (int k = 0, i = 4*b; k < 4 && i < A->size; ++k, ++i) A->ptr[i] = philox_uniform(r[k]) * v;
+    }
     _profile(_CPU_RAND_UNIFORM, 1);
 }
 
 void cpu_rand_signed_uniform(Tensor * A, float v)
 {
     _profile(_CPU_RAND_SIGNED_UNIFORM, 0);
+    uint64_t key = get_random_seed();
+    int blocks = (A->size + 3) / 4;
+    uint64_t base = reserve_random_counters(blocks);
+
     #pragma omp parallel for
-    for (int i = 0; i < A->size; ++i) A->ptr[i] = signed_uniform() * v;
+    for (int b = 0; b < blocks; ++b) {
+        uint32_t r[4];
+        philox4x32(base + b, key, r);
+        for (int k = 0, i = 4*b; k < 4 && i < A->size; ++k, ++i) A->ptr[i] = (2.0f * philox_uniform(r[k]) - 1.0f) * v;
+    }
     _profile(_CPU_RAND_SIGNED_UNIFORM, 1);
 }
 
 void cpu_rand_binary(Tensor * A, float v)
 {
     _profile(_CPU_BINARY, 0);
+    uint64_t key = get_random_seed();
+    int blocks = (A->size + 3) / 4;
+    uint64_t base = reserve_random_counters(blocks);
+
     #pragma omp parallel for
-    for (int i = 0; i < A->size; ++i)
-        if (uniform() < v) A->ptr[i] = 1.0;
-        else A->ptr[i] = 0.0;
+    for (int b = 0; b < blocks; ++b) {
+        uint32_t r[4];
+        philox4x32(base + b, key, r);
+        for (int k = 0, i = 4*b; k < 4 && i < A->size; ++k, ++i) A->ptr[i] = (philox_uniform(r[k]) < v) ? 1.0f : 0.0f;
+    }
     _profile(_CPU_BINARY, 1);
 }
 
 void cpu_rand_normal(Tensor * A, float m, float s, bool fast_math) {
     _profile(_CPU_RAND_NORMAL, 0);
-    int r = rand();
+    // Box-Muller: 4 uniforms give 4 normals. fast_math works in float with
+    // 24-bit uniforms (tails up to 5.8 sigma); otherwise in double with the
+    // 32 bits (up to 6.7 sigma)
+    uint64_t key = get_random_seed();
+    int blocks = (A->size + 3) / 4;
+    uint64_t base = reserve_random_counters(blocks);
 
-    if (fast_math) {
-        for (int i = 0; i < A->size; ++i) A->ptr[i] = fast_randn(m, s, r++);
-    } else  {
-        for (int i = 0; i < A->size; ++i) A->ptr[i] = slow_randn(m, s);
+    #pragma omp parallel for
+    for (int b = 0; b < blocks; ++b) {
+        uint32_t r[4];
+        float z[4];
+        philox4x32(base + b, key, r);
+        for (int k = 0; k < 4; k += 2) {
+            if (fast_math) {
+                float u1 = (float)((r[k] >> 8) + 1) * (1.0f / 16777216.0f);  // (0, 1]
+                float u2 = philox_uniform(r[k+1]);
+                float rad = std::sqrt(-2.0f * std::log(u1));
+                z[k] = rad * std::cos(6.28318530718f * u2);
+                z[k+1] = rad * std::sin(6.28318530718f * u2);
+            } else {
+                double u1 = ((double)r[k] + 1.0) * (1.0 / 4294967296.0);  // (0, 1]
+                double u2 = (double)r[k+1] * (1.0 / 4294967296.0);
+                double rad = std::sqrt(-2.0 * std::log(u1));
+                z[k] = (float)(rad * std::cos(6.283185307179586 * u2));
+                z[k+1] = (float)(rad * std::sin(6.283185307179586 * u2));
+            }
+        }
+        for (int k = 0, i = 4*b; k < 4 && i < A->size; ++k, ++i) A->ptr[i] = (z[k] * s) + m;
     }
-    _profile(_CPU_RAND_NORMAL, 0);
+    _profile(_CPU_RAND_NORMAL, 1);
 }
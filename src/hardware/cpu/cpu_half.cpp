@@ -0,0 +1,34 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+#include <string>
+
+#include "eddl/utils.h"
+#include "eddl/hardware/cpu/cpu_half.h"
+
+
+void cpu_float_to_half(const float *A, uint16_t *B, size_t n, int dtype){
+    if (dtype == DTYPE_BFLOAT16) {
+        #pragma omp parallel for
+        for (long int i = 0; i < (long int)n; i++) B[i] = float_to_bf16(A[i]);
+    } else {
+        #pragma omp parallel for
+        for (long int i = 0; i < (long int)n; i++) B[i] = float_to_fp16(A[i]);
+    }
+}
+
+void cpu_half_to_float(const uint16_t *A, float *B, size_t n, int dtype){
+    if (dtype == DTYPE_BFLOAT16) {
+        #pragma omp parallel for
+        for (long int i = 0; i < (long int)n; i++) B[i] = bf16_to_float(A[i]);
+    } else {
+        #pragma omp parallel for
+        for (long int i = 0; i < (long int)n; i++) B[i] = fp16_to_float(A[i]);
+    }
+}
@@ -8,6 +8,7 @@
 */
 
 #include <stdexcept>
+#include <algorithm>
 
 #include "eddl/hardware/cpu/cpu_tensor.h"
 
@@ -112,110 +113,209 @@ void cpu_reduce_sum2D(Tensor *A, Tensor *B, int axis, int incB) {
 }
 
 
-void cpu_reduction(ReduceDescriptor *RD){
+// Groups of the inner dim kept are split in blocks of this size (threads)
+#define RED_BLOCK 256
 
-    _profile(_CPU_REDUCTION, 0);
+// Offset in the input of the first element of group o, over the first n kept dims
+static inline int red_koff(ReduceDescriptor *RD, int o, int n) {
+  int off=0;
+  for(int k=n-1;k>=0;k--) {
+    off+=(o%RD->kshape[k])*RD->kstride[k];
+    o/=RD->kshape[k];
+  }
+  return off;
+}
 
-      float val,sum;
-      int ind;
-      int d;
-      int i,j,k,l,s;
+// val[o] = reduction (m: 0 mean, 1 sum, 2 max, 3 min) of group o of A, and
+// arg[o] its flat index in A (max, min)
+static void red_gather(ReduceDescriptor *RD, float *A, int m, float *val, float *arg) {
+  int L=RD->inner;
+  int nr=RD->roff.size();
+  int *roff=RD->roff.data();
+  float scale=(m==0) ? 1.0f/RD->group_size : 1.0f;
 
-      // [MEAN]: Compute items to be reduced
-      if (RD->m==0) {
-          d=1;
-          for(i=0;i<RD->axis.size();i++){
-              d *= RD->I->shape[RD->axis[i]];
-          }
-      }
+  if (RD->inner_red) {
+    // contiguous inner reductions, one group per iteration
+    int nk=RD->kshape.size();
 
-      //reduce
-      for(i=0;i<RD->index.size();i++)
-      {
-          sum=0;
-
-          for(j=0;j<RD->index[i].size();j++) {
-
-              float v=RD->I->ptr[RD->index[i][j]];
-              if (RD->m==2) {
-                  if (j==0) {val=v;ind=RD->index[i][j];}
-                  else if (v>val) {
-                      val=v;
-                      ind=RD->index[i][j];
-                  }
-              }
-              else if (RD->m==3) {
-                if (j==0) {val=v;ind=RD->index[i][j];}
-                else if (v<val) {
-                    val=v;
-                    ind=RD->index[i][j];
-                }
-              }
-              else sum+=v;
+    #pragma omp parallel for
+    for(int o=0;o<RD->groups;o++) {
+      float *base=A+red_koff(RD,o,nk);
+
+      if (m<2) {
+        float s=0.0f;
+        for(int r=0;r<nr;r++) {
+          float *p=base+roff[r];
+          #pragma omp simd reduction(+:s)
+          for(int i=0;i<L;i++) s+=p[i];
+        }
+        val[o]=s*scale;
+      }
+      else {
+        float v=base[roff[0]];
+        for(int r=0;r<nr;r++) {
+          float *p=base+roff[r];
+          if (m==2) {
+            #pragma omp simd reduction(max:v)
+            for(int i=0;i<L;i++) v=std::max(v,p[i]);
+          }
+          else {
+            #pragma omp simd reduction(min:v)
+            for(int i=0;i<L;i++) v=std::min(v,p[i]);
+          }
+        }
+        val[o]=v;
+
+        if (arg!=nullptr) {
+          // the first element if none matches (NaN slice)
+          int a=(base+roff[0])-A;
+          bool found=false;
+          for(int r=0;(r<nr)&&(!found);r++) {
+            float *p=base+roff[r];
+            for(int i=0;i<L;i++)
+              if (p[i]==v) { a=(p-A)+i; found=true; break; }
           }
+          arg[o]=a;
+        }
+      }
+    }
+  }
+  else {
+    // the inner dim is kept: contiguous rows are reduced lane by lane
+    int nk=RD->kshape.size()-1;
+    int outer=RD->groups/L;
+    int nb=(L+RED_BLOCK-1)/RED_BLOCK;
 
-          // set in Output
-          if (RD->m<2) { // mean or sum
-              if (RD->m==0) sum/=d;
-              if (RD->keepdims) {
-                  for(j=0;j<RD->index[i].size();j++) {
-                      RD->O->ptr[RD->index[i][j]]=sum;
-                    }
-              }
-              else RD->O->ptr[i]=sum;
+    #pragma omp parallel for
+    for(int t=0;t<outer*nb;t++) {
+      int oo=t/nb;
+      int j0=(t%nb)*RED_BLOCK;
+      int j1=std::min(L,j0+RED_BLOCK);
+      float *base=A+red_koff(RD,oo,nk);
+      float *v=val+oo*L;
+      float *a=(arg!=nullptr) ? arg+oo*L : nullptr;
+
+      float *p=base+roff[0];
+      for(int j=j0;j<j1;j++) v[j]=p[j];
+      if (a!=nullptr)
+        for(int j=j0;j<j1;j++) a[j]=(p-A)+j;
+
+      for(int r=1;r<nr;r++) {
+        p=base+roff[r];
+        if (m<2) {
+          #pragma omp simd
+          for(int j=j0;j<j1;j++) v[j]+=p[j];
+        }
+        else if (a==nullptr) {
+          if (m==2) {
+            #pragma omp simd
+            for(int j=j0;j<j1;j++) v[j]=std::max(v[j],p[j]);
           }
-          else { // max or min
-              if (RD->keepdims) {
-                  for(j=0;j<RD->index[i].size();j++) {
-                      RD->O->ptr[RD->index[i][j]]=val;
-                      RD->S->ptr[RD->index[i][j]]=ind;
-                  }
-              }
-              else {
-                  RD->O->ptr[i]=val;
-                  RD->S->ptr[i]=ind;
-              }
+          else {
+            #pragma omp simd
+            for(int j=j0;j<j1;j++) v[j]=std::min(v[j],p[j]);
           }
+        }
+        else {
+          int off=p-A;
+          for(int j=j0;j<j1;j++)
+            if ((m==2) ? (p[j]>v[j]) : (p[j]<v[j])) { v[j]=p[j]; a[j]=off+j; }
+        }
+      }
 
-      }// i
-      _profile(_CPU_REDUCTION, 1);
+      if (m==0)
+        for(int j=j0;j<j1;j++) v[j]*=scale;
+    }
   }
+}
 
-  void cpu_reduction_back(ReduceDescriptor *RD){
+// f(o,p) for every position p (flat index in the input) of every group o.
+// All the positions of a group are visited by the same thread
+template<typename F>
+static void red_foreach(ReduceDescriptor *RD, F f) {
+  int L=RD->inner;
+  int nr=RD->roff.size();
+  int *roff=RD->roff.data();
 
-  _profile(_CPU_REDUCTION_BACK, 0);
+  if (RD->inner_red) {
+    int nk=RD->kshape.size();
 
-      float val,sum;
-      int ind;
-      int d;
-      int i,j,k,l,s;
+    #pragma omp parallel for
+    for(int o=0;o<RD->groups;o++) {
+      int base=red_koff(RD,o,nk);
+      for(int r=0;r<nr;r++)
+        for(int i=0;i<L;i++) f(o,base+roff[r]+i);
+    }
+  }
+  else {
+    int nk=RD->kshape.size()-1;
+    int outer=RD->groups/L;
+    int nb=(L+RED_BLOCK-1)/RED_BLOCK;
 
-      if (RD->m==0) {
-          d=1;
-          for(i=0;i<RD->axis.size();i++){
-              d *= RD->I->shape[RD->axis[i]];
-          }
-      }
+    #pragma omp parallel for
+    for(int t=0;t<outer*nb;t++) {
+      int oo=t/nb;
+      int j0=(t%nb)*RED_BLOCK;
+      int j1=std::min(L,j0+RED_BLOCK);
+      int base=red_koff(RD,oo,nk);
+      for(int r=0;r<nr;r++)
+        for(int j=j0;j<j1;j++) f(oo*L+j,base+roff[r]+j);
+    }
+  }
+}
+
+
+void cpu_reduction(ReduceDescriptor *RD){
+  _profile(_CPU_REDUCTION, 0);
+  float *O=RD->O->ptr;
+  float *S=(RD->S!=nullptr) ? RD->S->ptr : nullptr;
 
-      for(i=0;i<RD->index.size();i++)
-        {
-            if (RD->m>=2) {
-                int p=RD->S->ptr[i];
-                RD->ID->ptr[p]+=RD->D->ptr[i];
-            }
-            else {
-              val=0;
-              if(RD->keepdims) {
-                for(j=0;j<RD->index[i].size();j++)
-                  val+=RD->D->ptr[RD->index[i][j]];
-              }
-              else val=RD->D->ptr[i];
-
-              if (RD->m==0) val/=d;
-              for(j=0;j<RD->index[i].size();j++)
-                RD->ID->ptr[RD->index[i][j]]+=val;
-            }
-        }//i
-
-        _profile(_CPU_REDUCTION_BACK, 1);
+  if (!RD->keepdims) {
+    red_gather(RD,RD->I->ptr,RD->m,O,S);
+  }
+  else {
+    // reduced value (and index) repeated over the group
+    float *val=get_fmem(RD->groups,"cpu_reduction");
+    float *arg=(S!=nullptr) ? get_fmem(RD->groups,"cpu_reduction") : nullptr;
+
+    red_gather(RD,RD->I->ptr,RD->m,val,arg);
+    red_foreach(RD,[&](int o, int p) {
+      O[p]=val[o];
+      if (S!=nullptr) S[p]=arg[o];
+    });
+
+    free_fmem(val);
+    if (arg!=nullptr) free_fmem(arg);
+  }
+  _profile(_CPU_REDUCTION, 1);
+}
+
+void cpu_reduction_back(ReduceDescriptor *RD){
+  _profile(_CPU_REDUCTION_BACK, 0);
+  float *D=RD->D->ptr;
+  float *ID=RD->ID->ptr;
+
+  if (RD->m>=2) {
+    // to the selected element
+    float *S=RD->S->ptr;
+    if (!RD->keepdims) {
+      #pragma omp parallel for
+      for(int o=0;o<RD->groups;o++) ID[(int)S[o]]+=D[o];
     }
+    else red_foreach(RD,[&](int o, int p) { ID[(int)S[p]]+=D[p]; });
+  }
+  else {
+    float scale=(RD->m==0) ? 1.0f/RD->group_size : 1.0f;
+    if (!RD->keepdims) {
+      red_foreach(RD,[&](int o, int p) { ID[p]+=D[o]*scale; });
+    }
+    else {
+      // all the outputs of a group come from all its inputs
+      float *g=get_fmem(RD->groups,"cpu_reduction_back");
+      red_gather(RD,D,1,g,nullptr);
+      red_foreach(RD,[&](int o, int p) { ID[p]+=g[o]*scale; });
+      free_fmem(g);
+    }
+  }
+  _profile(_CPU_REDUCTION_BACK, 1);
+}
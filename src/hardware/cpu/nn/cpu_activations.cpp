@@ -11,6 +11,7 @@
 #include <cstdio>      /* printf, scanf, NULL */
 #include <cstdlib>     /* malloc, free, rand */
 #include <iostream>
+#include <algorithm>
 
 #include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
 
@@ -34,6 +35,36 @@ void cpu_d_relu(Tensor *D, Tensor *I, Tensor *PD){
     _profile(_CPU_D_RELU, 1);
 }
 
+void cpu_bias_act(Tensor *A, Tensor *bias, int act){
+  _profile(_CPU_BIAS_ACT, 0);
+  int chans=A->shape[1];
+  int rc=A->size/(A->shape[0]*chans);  // 1 for {B,C}
+
+  #pragma omp parallel for
+  for (int p = 0; p < A->shape[0]*chans; p++) {
+    float *ptr=A->ptr+(size_t)(p/chans)*A->stride[0]+(size_t)(p%chans)*rc;  // A may be a slice of a concat
+    float b=(bias!=nullptr) ? bias->ptr[p%chans] : 0.0f;
+
+    if (act==FUSED_ACT_RELU) {
+      #pragma omp simd
+      for (int i = 0; i < rc; i++) ptr[i]=std::max(ptr[i]+b, 0.0f);
+    }
+    else if (act==FUSED_ACT_SIGMOID) {
+      #pragma omp simd
+      for (int i = 0; i < rc; i++) ptr[i]=cpu_sigmoid_f(ptr[i]+b);
+    }
+    else if (act==FUSED_ACT_TANH) {
+      #pragma omp simd
+      for (int i = 0; i < rc; i++) ptr[i]=cpu_tanh_f(ptr[i]+b);
+    }
+    else {
+      #pragma omp simd
+      for (int i = 0; i < rc; i++) ptr[i]+=b;
+    }
+  }
+  _profile(_CPU_BIAS_ACT, 1);
+}
+
 void cpu_thresholded_relu(Tensor *A, Tensor *B,float param){
   _profile(_CPU_THRESHOLDED_RELU, 0);
   #pragma omp parallel for
@@ -224,29 +255,38 @@ void cpu_d_tanh(Tensor *D, Tensor *I, Tensor *PD){
 
 void cpu_softmax(Tensor *A, Tensor *B) {
   _profile(_CPU_SOFTMAX, 0);
-  float max, sum;
+  int cols = A->shape[1];
 
-  //#pragma omp parallel for
+  // One row (sample) per iteration: contiguous and vectorized
+  #pragma omp parallel for
   for (int i = 0; i < A->shape[0]; i++) {
-    max = (*A->ptr2).col(i).maxCoeff();
-    for (int j = 0; j < A->shape[1]; j++)
-    (*B->ptr2)(j, i) = std::exp((*A->ptr2)(j, i) - max);
+    const float *a = A->ptr + i * cols;
+    float *b = B->ptr + i * cols;
+
+    float max = a[0];
+    #pragma omp simd reduction(max:max)
+    for (int j = 0; j < cols; j++)
+      max = (a[j] > max) ? a[j] : max;
+
+    float sum = 0.0f;
+    #pragma omp simd reduction(+:sum)
+    for (int j = 0; j < cols; j++) {
+      b[j] = cpu_exp_nonpos(a[j] - max);
+      sum += b[j];
+    }
 
-    sum = (*B->ptr2).col(i).sum();
-    for (int j = 0; j < B->shape[1]; j++)
-    (*B->ptr2)(j, i) = (*B->ptr2)(j, i) / sum;
+    float inv = 1.0f / sum;
+    #pragma omp simd
+    for (int j = 0; j < cols; j++)
+      b[j] *= inv;
   }
     _profile(_CPU_SOFTMAX, 1);
 }
 
 void cpu_d_softmax(Tensor *D, Tensor *I, Tensor *PD) {
     _profile(_CPU_D_SOFTMAX, 0);
-  PD->tsem->lock();
-
-  #pragma omp parallel for
+  #pragma omp parallel for simd
   for (int i = 0; i < D->size; i++)
-    PD->ptr[i] += D->ptr[i] * (I->ptr[i] * (1.0 - I->ptr[i]));
-
-  PD->tsem->unlock();
+    PD->ptr[i] += D->ptr[i] * (I->ptr[i] * (1.0f - I->ptr[i]));
     _profile(_CPU_D_SOFTMAX, 1);
 }
@@ -10,6 +10,8 @@
 
 #include <cstdio>      /* printf, scanf, NULL */
 #include <cstdlib>     /* malloc, free, rand */
+#include <cmath>
+#include <algorithm>
 #include <iostream>
 
 #include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
@@ -113,3 +115,211 @@ void cpu_permute_batch_first(Tensor *A,Tensor *B)
     _profile(_CPU_PERMUTE_BATCH_FIRST, 1);
 
 }
+
+
+// Channels per task when the input is {B,C}
+#define BN_BLOCK 256
+
+// Batchnorm over {B,C} or {B,C,H,W} (NCHW): statistics per channel C,
+// reduced over the batch and the spatial dimensions
+void cpu_batchnorm_forward(Tensor *input, Tensor *output, Tensor *opa,
+                           Tensor *mean, Tensor *variance,
+                           Tensor *bn_g, Tensor *bn_b,
+                           Tensor *bn_mean, Tensor *bn_var,
+                           float momentum, float epsilon, int trmode)
+{
+  _profile(_CPU_BN_FORWARD, 0);
+  int b=input->shape[0];
+  int z=input->shape[1];
+  int rc=input->size/(b*z);
+
+  if (trmode) {
+    if (rc>1) {
+      // Welford (Chan) merge of the per-plane mean and M2, one read per plane
+      #pragma omp parallel for
+      for(int j=0;j<z;j++) {
+        double n=0.0, m=0.0, m2=0.0;
+        for(int i=0;i<b;i++) {
+          float *px=input->ptr+(i*z+j)*rc;
+
+          float s=0.0f;
+          #pragma omp simd reduction(+:s)
+          for(int k=0;k<rc;k++) s+=px[k];
+          float pm=s/rc;
+
+          float q=0.0f;
+          #pragma omp simd reduction(+:q)
+          for(int k=0;k<rc;k++) q+=(px[k]-pm)*(px[k]-pm);
+
+          double d=pm-m;
+          double nt=n+rc;
+          m+=d*rc/nt;
+          m2+=q+d*d*n*rc/nt;
+          n=nt;
+        }
+        bn_mean->ptr[j]=m;
+        bn_var->ptr[j]=m2/n;
+      }
+    }
+    else {
+      // {B,C}: Welford row by row, vectorized over blocks of channels
+      float *m=bn_mean->ptr;
+      float *m2=bn_var->ptr;
+
+      #pragma omp parallel for
+      for(int jb=0;jb<z;jb+=BN_BLOCK) {
+        int je=std::min(z,jb+BN_BLOCK);
+        for(int j=jb;j<je;j++) m[j]=m2[j]=0.0f;
+
+        for(int i=0;i<b;i++) {
+          float *px=input->ptr+i*z;
+          float inv=1.0f/(i+1);
+          #pragma omp simd
+          for(int j=jb;j<je;j++) {
+            float d=px[j]-m[j];
+            m[j]+=d*inv;
+            m2[j]+=d*(px[j]-m[j]);
+          }
+        }
+        for(int j=jb;j<je;j++) m2[j]/=b;
+      }
+    }
+
+    // Update global statistics
+    if (momentum!=0.0) {
+      for(int j=0;j<z;j++) {
+        mean->ptr[j]=momentum*mean->ptr[j]+(1.0f-momentum)*bn_mean->ptr[j];
+        variance->ptr[j]=momentum*variance->ptr[j]+(1.0f-momentum)*bn_var->ptr[j];
+      }
+    }
+
+    // sd=sqrt(var+epsilon)
+    for(int j=0;j<z;j++) bn_var->ptr[j]=std::sqrt(bn_var->ptr[j]+epsilon);
+  }
+  else {
+    for(int j=0;j<z;j++) bn_var->ptr[j]=std::sqrt(variance->ptr[j]+epsilon);
+  }
+
+  float *pmean=(trmode) ? bn_mean->ptr : mean->ptr;
+
+  // opa=(x-mean)/sd, output=gamma*opa+beta
+  if (rc>1) {
+    #pragma omp parallel for
+    for(int p=0;p<b*z;p++) {
+      int j=p%z;
+      float m=pmean[j];
+      float isd=1.0f/bn_var->ptr[j];
+      float g=(bn_g!=nullptr) ? bn_g->ptr[j] : 1.0f;
+      float bb=(bn_b!=nullptr) ? bn_b->ptr[j] : 0.0f;
+      float *px=input->ptr+p*rc;
+      float *pa=opa->ptr+p*rc;
+      float *po=output->ptr+p*rc;
+      #pragma omp simd
+      for(int k=0;k<rc;k++) {
+        pa[k]=(px[k]-m)*isd;
+        po[k]=g*pa[k]+bb;
+      }
+    }
+  }
+  else {
+    #pragma omp parallel for
+    for(int i=0;i<b;i++) {
+      float *px=input->ptr+i*z;
+      float *pa=opa->ptr+i*z;
+      float *po=output->ptr+i*z;
+      #pragma omp simd
+      for(int j=0;j<z;j++)
+        pa[j]=(px[j]-pmean[j])/bn_var->ptr[j];
+      if (bn_g!=nullptr) {
+        #pragma omp simd
+        for(int j=0;j<z;j++)
+          po[j]=bn_g->ptr[j]*pa[j]+bn_b->ptr[j];
+      }
+      else {
+        #pragma omp simd
+        for(int j=0;j<z;j++)
+          po[j]=pa[j];
+      }
+    }
+  }
+  _profile(_CPU_BN_FORWARD, 1);
+}
+
+// PD+=dE/dX, with gradients of gamma and beta (means over the batch, as in BN_backward)
+void cpu_batchnorm_backward(Tensor *delta, Tensor *opa, Tensor *pdelta,
+                            Tensor *gbn_g, Tensor *gbn_b,
+                            Tensor *bn_g, Tensor *bn_var)
+{
+  _profile(_CPU_BN_BACKWARD, 0);
+  int b=delta->shape[0];
+  int z=delta->shape[1];
+  int rc=delta->size/(b*z);
+  float N=b*rc;
+
+  float *sdy=get_fmem(2*z,"cpu_batchnorm_backward");
+  float *sdyo=sdy+z;
+
+  if (rc>1) {
+    #pragma omp parallel for
+    for(int j=0;j<z;j++) {
+      double s=0.0, so=0.0;
+      for(int i=0;i<b;i++) {
+        float *pd=delta->ptr+(i*z+j)*rc;
+        float *pa=opa->ptr+(i*z+j)*rc;
+        float ps=0.0f, pso=0.0f;
+        #pragma omp simd reduction(+:ps,pso)
+        for(int k=0;k<rc;k++) {
+          ps+=pd[k];
+          pso+=pd[k]*pa[k];
+        }
+        s+=ps;
+        so+=pso;
+      }
+      sdy[j]=s;
+      sdyo[j]=so;
+    }
+  }
+  else {
+    #pragma omp parallel for
+    for(int jb=0;jb<z;jb+=BN_BLOCK) {
+      int je=std::min(z,jb+BN_BLOCK);
+      for(int j=jb;j<je;j++) sdy[j]=sdyo[j]=0.0f;
+
+      for(int i=0;i<b;i++) {
+        float *pd=delta->ptr+i*z;
+        float *pa=opa->ptr+i*z;
+        #pragma omp simd
+        for(int j=jb;j<je;j++) {
+          sdy[j]+=pd[j];
+          sdyo[j]+=pd[j]*pa[j];
+        }
+      }
+    }
+  }
+
+  for(int j=0;j<z;j++) {
+    sdy[j]/=N;   // mean(dE/dY)
+    sdyo[j]/=N;  // mean(dE/dY * Y)
+    if (gbn_g!=nullptr) {
+      gbn_g->ptr[j]+=sdyo[j];
+      gbn_b->ptr[j]+=sdy[j];
+    }
+  }
+
+  // dE/dX = gamma*(dE/dY - mean(dE/dY) - mean(dE/dY * Y) * Y)/sd
+  #pragma omp parallel for
+  for(int p=0;p<b*z;p++) {
+    int j=p%z;
+    float k=((bn_g!=nullptr) ? bn_g->ptr[j] : 1.0f)/bn_var->ptr[j];
+    float md=sdy[j], mdo=sdyo[j];
+    float *pd=delta->ptr+p*rc;
+    float *pa=opa->ptr+p*rc;
+    float *pp=pdelta->ptr+p*rc;
+    #pragma omp simd
+    for(int q=0;q<rc;q++)
+      pp[q]+=k*(pd[q]-md-mdo*pa[q]);
+  }
+
+  free_fmem(sdy);
+  _profile(_CPU_BN_BACKWARD, 1);
+}
@@ -10,6 +10,11 @@
 #include <cstdio>      /* printf, scanf, NULL */
 #include <cstdlib>     /* malloc, free, rand */
 #include <iostream>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
 
@@ -39,34 +44,34 @@ void add_pixel(int b,int px,int py,int pz,ConvolDescriptor *D,int isize,int irsi
 }
 
 
-void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im)
+// Lowers the output pixels [j0,j1) of group g of sample b (or adds them back
+// with col2im): ptrI is column-major with j1-j0 rows and kz*kr*kc columns
+void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im,int j0,int j1,int g)
 {
   _profile(_CPU_IM2COL, 0);
   int i,j,k;
   int pz,py,px,y,x;
   int ksize=D->kr*D->kc;
-  int kr2=D->kr/2;
-  int kc2=D->kc/2;
-
-  if (kc2==0) kc2=-1;
 
-  int orsize=D->r*D->c;
+  int rows=j1-j0;
+  int lcols=D->kz*D->kr*D->kc;
 
   int isize=D->ir*D->ic*D->iz;
   int irsize=D->ir*D->ic;
 
-  k=0;
-  py=-D->padrt;
-  px=-D->padcl;
-
+  // output pixel (oy,ox) of row j
+  int oy=j0/D->c;
+  int ox=j0%D->c;
 
-  for(j=0;j<D->matI.rows();j++) {
+  for(j=0;j<rows;j++) {
     k=j;
+    py=-D->padrt+oy*D->sr;
+    px=-D->padcl+ox*D->sc;
 
-    for(i=0;i<D->matI.cols();i++,k+=orsize) {
-      pz=i/ksize;
-      y=py+(i%ksize)/D->kc;
-      x=px+(i%D->kc);
+    for(i=0;i<lcols;i++,k+=rows) {
+      pz=g*D->kz+i/ksize;
+      y=py+((i%ksize)/D->kc)*D->dr;
+      x=px+(i%D->kc)*D->dc;
 
       if(col2im)
       add_pixel(b,x,y,pz,D,isize,irsize,ptrI[k]);
@@ -74,122 +79,575 @@ void im2col(int b,ConvolDescriptor *D,float *ptrI,int col2im)
       ptrI[k]=get_pixel(b,x,y,pz,D,isize,irsize);
 
     }
-    px+=D->sc;
-    if (px>=D->ic+D->padcl-kc2-1) {
-      px=-D->padcl;
-      py+=D->sr;
+    if (++ox==D->c) {
+      ox=0;
+      oy++;
     }
   }
     _profile(_CPU_IM2COL, 1);
 }
 
 
+// Depthwise convolutions (kz==1): each output plane is a sum of shifted and
+// scaled rows of one input plane. For a kernel tap at offset off, the output
+// columns [x0,x1) read the input columns x*s+off inside the image
+static inline void dw_range(int off, int s, int len, int n, int &x0, int &x1) {
+  x0=(off<0) ? (-off+s-1)/s : 0;
+  x1=(len>off) ? std::min(n,(len-off+s-1)/s) : 0;
+}
+
+static inline void dw_axpy(float *y, const float *x, float w, int s, int off, int x0, int x1) {
+  if (s==1) {
+    #pragma omp simd
+    for(int i=x0;i<x1;i++) y[i]+=w*x[i+off];
+  }
+  else {
+    #pragma omp simd
+    for(int i=x0;i<x1;i++) y[i]+=w*x[i*s+off];
+  }
+}
+
+static inline void dw_scatter(float *y, const float *x, float w, int s, int off, int x0, int x1) {
+  if (s==1) {
+    #pragma omp simd
+    for(int i=x0;i<x1;i++) y[i+off]+=w*x[i];
+  }
+  else {
+    #pragma omp simd
+    for(int i=x0;i<x1;i++) y[i*s+off]+=w*x[i];
+  }
+}
+
+static inline float dw_dot(const float *y, const float *x, int s, int off, int x0, int x1) {
+  float sum=0.0f;
+  if (s==1) {
+    #pragma omp simd reduction(+:sum)
+    for(int i=x0;i<x1;i++) sum+=y[i]*x[i+off];
+  }
+  else {
+    #pragma omp simd reduction(+:sum)
+    for(int i=x0;i<x1;i++) sum+=y[i]*x[i*s+off];
+  }
+  return sum;
+}
+
+static void cpu_conv2D_depthwise(ConvolDescriptor *D)
+{
+  int m=D->nk/D->groups; // output channels of each input channel
+  int orsize=D->r*D->c;
+  int irsize=D->ir*D->ic;
+  int ksize=D->kr*D->kc;
+
+  // one output plane per task
+  #pragma omp parallel for
+  for(int p=0;p<D->I->shape[0]*D->nk;p++){
+    int b=p/D->nk, o=p%D->nk;
+    const float *ptrI=D->I->ptr+((size_t)b*D->iz+o/m)*irsize;
+    const float *ptrK=D->K->ptr+o*ksize;
+    float *ptrO=D->O->ptr+(size_t)b*D->O->stride[0]+(size_t)o*orsize;
+
+    std::fill(ptrO,ptrO+orsize,0.0f);
+    for(int y=0;y<D->r;y++)
+      for(int i=0;i<D->kr;i++){
+        int py=y*D->sr-D->padrt+i*D->dr;
+        if ((py<0)||(py>=D->ir)) continue;
+
+        for(int j=0;j<D->kc;j++){
+          int off=j*D->dc-D->padcl, x0, x1;
+          dw_range(off,D->sc,D->ic,D->c,x0,x1);
+          dw_axpy(ptrO+y*D->c,ptrI+py*D->ic,ptrK[i*D->kc+j],D->sc,off,x0,x1);
+        }
+      }
+  }
+}
+
+static void cpu_conv2D_grad_depthwise(ConvolDescriptor *D)
+{
+  int m=D->nk/D->groups;
+  int orsize=D->r*D->c;
+  int irsize=D->ir*D->ic;
+  int ksize=D->kr*D->kc;
+
+  // one kernel per task, so the batch is reduced without partial gradients
+  #pragma omp parallel for
+  for(int o=0;o<D->nk;o++){
+    float *ptrgK=D->gK->ptr+o*ksize;
+
+    for(int b=0;b<D->I->shape[0];b++){
+      const float *ptrI=D->I->ptr+((size_t)b*D->iz+o/m)*irsize;
+      const float *ptrD=D->D->ptr+(size_t)b*D->D->stride[0]+(size_t)o*orsize;
+
+      for(int y=0;y<D->r;y++)
+        for(int i=0;i<D->kr;i++){
+          int py=y*D->sr-D->padrt+i*D->dr;
+          if ((py<0)||(py>=D->ir)) continue;
+
+          for(int j=0;j<D->kc;j++){
+            int off=j*D->dc-D->padcl, x0, x1;
+            dw_range(off,D->sc,D->ic,D->c,x0,x1);
+            ptrgK[i*D->kc+j]+=dw_dot(ptrD+y*D->c,ptrI+py*D->ic,D->sc,off,x0,x1);
+          }
+        }
+    }
+  }
+}
+
+static void cpu_conv2D_back_depthwise(ConvolDescriptor *D)
+{
+  int m=D->nk/D->groups;
+  int orsize=D->r*D->c;
+  int irsize=D->ir*D->ic;
+  int ksize=D->kr*D->kc;
+
+  // one input plane per task: it only receives the deltas of its m outputs
+  #pragma omp parallel for
+  for(int p=0;p<D->I->shape[0]*D->iz;p++){
+    int b=p/D->iz, ch=p%D->iz;
+    float *ptrID=D->ID->ptr+(size_t)p*irsize;
+
+    for(int o=ch*m;o<(ch+1)*m;o++){
+      const float *ptrK=D->K->ptr+o*ksize;
+      const float *ptrD=D->D->ptr+(size_t)b*D->D->stride[0]+(size_t)o*orsize;
+
+      for(int y=0;y<D->r;y++)
+        for(int i=0;i<D->kr;i++){
+          int py=y*D->sr-D->padrt+i*D->dr;
+          if ((py<0)||(py>=D->ir)) continue;
+
+          for(int j=0;j<D->kc;j++){
+            int off=j*D->dc-D->padcl, x0, x1;
+            dw_range(off,D->sc,D->ic,D->c,x0,x1);
+            dw_scatter(ptrID+py*D->ic,ptrD+y*D->c,ptrK[i*D->kc+j],D->sc,off,x0,x1);
+          }
+        }
+    }
+  }
+}
+
+
+// Winograd F(mxm,3x3) transforms (Lavin & Gray). Tiles are alpha x alpha, alpha=m+2
+static const float wino2_BT[4*4]={1, 0,-1, 0,
+                                  0, 1, 1, 0,
+                                  0,-1, 1, 0,
+                                  0, 1, 0,-1};
+static const float wino2_G[4*3]={1.0f, 0.0f, 0.0f,
+                                 0.5f, 0.5f, 0.5f,
+                                 0.5f,-0.5f, 0.5f,
+                                 0.0f, 0.0f, 1.0f};
+static const float wino2_AT[2*4]={1, 1, 1, 0,
+                                  0, 1,-1,-1};
+
+static const float wino4_BT[6*6]={4, 0,-5, 0, 1, 0,
+                                  0,-4,-4, 1, 1, 0,
+                                  0, 4,-4,-1, 1, 0,
+                                  0,-2,-1, 2, 1, 0,
+                                  0, 2,-1,-2, 1, 0,
+                                  0, 4, 0,-5, 0, 1};
+static const float wino4_G[6*3]={ 1.0f/4,   0.0f,     0.0f,
+                                 -1.0f/6,  -1.0f/6,  -1.0f/6,
+                                 -1.0f/6,   1.0f/6,  -1.0f/6,
+                                  1.0f/24,  1.0f/12,  1.0f/6,
+                                  1.0f/24, -1.0f/12,  1.0f/6,
+                                  0.0f,     0.0f,     1.0f};
+static const float wino4_AT[4*6]={1, 1, 1, 1, 1, 0,
+                                  0, 1,-1, 2,-2, 0,
+                                  0, 1, 1, 4, 4, 0,
+                                  0, 1,-1, 8,-8, 1};
+
+// Y = L * X * R^T, with L (n x k), X (k x k) and R (n x k)
+static inline void wino_transform(const float *L, const float *X, const float *R, float *Y, int n, int k, float *tmp){
+  for(int i=0;i<n;i++)
+    for(int j=0;j<k;j++) {
+      float sum=0.0f;
+      for(int l=0;l<k;l++) sum+=L[i*k+l]*X[l*k+j];
+      tmp[i*k+j]=sum;
+    }
+  for(int i=0;i<n;i++)
+    for(int j=0;j<n;j++) {
+      float sum=0.0f;
+      for(int l=0;l<k;l++) sum+=tmp[i*k+l]*R[j*k+l];
+      Y[i*n+j]=sum;
+    }
+}
+
+static void cpu_conv2D_winograd(ConvolDescriptor *D)
+{
+  const int m=(D->cpu_algo==CONV_ALGO_WINOGRAD_4X4) ? 4 : 2;
+  const int alpha=m+2;
+  const int a2=alpha*alpha;
+  const float *BT=(m==4) ? wino4_BT : wino2_BT;
+  const float *G=(m==4) ? wino4_G : wino2_G;
+  const float *AT=(m==4) ? wino4_AT : wino2_AT;
+
+  const int tr=(D->r+m-1)/m;
+  const int tc=(D->c+m-1)/m;
+  const int T=tr*tc;
+  const int isize=D->iz*D->ir*D->ic;
+  const int irsize=D->ir*D->ic;
+
+  // Kernel transform, U[xi] is (kz x nk)
+  float *U=get_fmem(a2*D->kz*D->nk,"cpu_conv2D_winograd");
+  #pragma omp parallel for
+  for(int k=0;k<D->nk;k++) {
+    float g[9],u[36],tmp[18];
+    for(int ch=0;ch<D->kz;ch++) {
+      for(int i=0;i<9;i++) g[i]=D->K->ptr[(k*D->kz+ch)*9+i];
+      // u = G g G^T
+      for(int i=0;i<alpha;i++)
+        for(int j=0;j<3;j++)
+          tmp[i*3+j]=G[i*3]*g[j]+G[i*3+1]*g[3+j]+G[i*3+2]*g[6+j];
+      for(int i=0;i<alpha;i++)
+        for(int j=0;j<alpha;j++)
+          u[i*alpha+j]=tmp[i*3]*G[j*3]+tmp[i*3+1]*G[j*3+1]+tmp[i*3+2]*G[j*3+2];
+      for(int xi=0;xi<a2;xi++) U[xi*D->kz*D->nk+k*D->kz+ch]=u[xi];
+    }
+  }
+
+  #pragma omp parallel
+  {
+    // Per-thread workspace: V[xi] is (T x kz), M[xi] is (T x nk)
+    float *V=get_fmem(a2*T*D->kz,"cpu_conv2D_winograd");
+    float *M=get_fmem(a2*T*D->nk,"cpu_conv2D_winograd");
+    float d[36],v[36],tmp[36],y[16];
+
+    #pragma omp for
+    for(int b=0;b<D->I->shape[0];b++){
+      const float *ptrI=D->I->ptr+(b*isize);
+      float *ptrO=D->O->ptr+(size_t)b*D->O->stride[0];
+
+      // Input transform: v = B^T d B
+      for(int ch=0;ch<D->kz;ch++)
+        for(int ty=0;ty<tr;ty++)
+          for(int tx=0;tx<tc;tx++) {
+            int y0=ty*m-D->padrt;
+            int x0=tx*m-D->padcl;
+            for(int i=0;i<alpha;i++)
+              for(int j=0;j<alpha;j++) {
+                int py=y0+i, px=x0+j;
+                d[i*alpha+j]=(py<0 || py>=D->ir || px<0 || px>=D->ic) ? 0.0f : ptrI[ch*irsize+py*D->ic+px];
+              }
+            wino_transform(BT,d,BT,v,alpha,alpha,tmp);
+            int t=ty*tc+tx;
+            for(int xi=0;xi<a2;xi++) V[(xi*D->kz+ch)*T+t]=v[xi];
+          }
+
+      // One GEMM per transformed coordinate
+      for(int xi=0;xi<a2;xi++) {
+        Eigen::Map<Eigen::MatrixXf> matV(V+xi*T*D->kz,T,D->kz);
+        Eigen::Map<Eigen::MatrixXf> matU(U+xi*D->kz*D->nk,D->kz,D->nk);
+        Eigen::Map<Eigen::MatrixXf> matM(M+xi*T*D->nk,T,D->nk);
+        matM.noalias()=matV*matU;
+      }
+
+      // Output transform: y = A^T m A
+      for(int k=0;k<D->nk;k++)
+        for(int ty=0;ty<tr;ty++)
+          for(int tx=0;tx<tc;tx++) {
+            int t=ty*tc+tx;
+            for(int xi=0;xi<a2;xi++) d[xi]=M[(xi*D->nk+k)*T+t];
+            wino_transform(AT,d,AT,y,m,alpha,tmp);
+            for(int i=0;i<m && ty*m+i<D->r;i++)
+              for(int j=0;j<m && tx*m+j<D->c;j++)
+                ptrO[(k*D->r+ty*m+i)*D->c+tx*m+j]=y[i*m+j];
+          }
+    }// batch
+
+    free_fmem(V);
+    free_fmem(M);
+  }
+
+  free_fmem(U);
+}
+
+
+// Lowered matrices are column-major: the rows [j0,j0+rows) of a sample, at
+// its workspace slot (see ConvolDescriptor::workspace)
+typedef Eigen::Map<Eigen::MatrixXf,0,Eigen::OuterStride<>> StridedMap;
+
+static inline int conv_thread() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
 void cpu_conv2D(ConvolDescriptor *D)
 {
   _profile(_CPU_CONV2D, 0);
-  int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
-
-  float *ptrO=D->O->ptr;
-  float *ptrI=D->ptrI;
+  int orsize=D->r*D->c;
+  int lcols=D->kc*D->kr*D->kz;
 
   // Map memory to Eigen
   new(&D->matK) Eigen::Map<Eigen::MatrixXf>(D->K->ptr, D->kr * D->kc * D->kz, D->nk);
-  new(&D->matI) Eigen::Map<Eigen::MatrixXf>(D->ptrI, D->r*D->c,D->kz*D->kr*D->kc);
 
-  #pragma omp parallel for
-  for(int b=0;b<D->I->shape[0];b++){
+  if (D->cpu_algo==CONV_ALGO_WINOGRAD_2X2 || D->cpu_algo==CONV_ALGO_WINOGRAD_4X4) {
+    cpu_conv2D_winograd(D);
+  }
+  else if (D->cpu_algo==CONV_ALGO_DEPTHWISE) {
+    cpu_conv2D_depthwise(D);
+  }
+  else if (D->cpu_algo==CONV_ALGO_DIRECT_1X1) {
+    // The input planes already are the lowered matrix
+    int iisize=D->iz*D->ir*D->ic;
 
-    float *ptrO=D->O->ptr+(b*osize);
-    float *ptrI=D->ptrI+(b*isize);
+    #pragma omp parallel for
+    for(int b=0;b<D->I->shape[0];b++){
+      Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(D->I->ptr+(b*iisize),D->r*D->c,D->kz);
+      Eigen::Map<Eigen::MatrixXf> matO=Eigen::Map<Eigen::MatrixXf>(D->O->ptr+(size_t)b*D->O->stride[0],D->r*D->c,D->z);
+
+      matO.noalias()=matI*D->matK;
+    }// batch
+  }
+  else {
+    float *ws=D->workspace();
+    int rows=D->lowering_rows();
+    int tiles=(orsize+rows-1)/rows;
+    int ng=D->nk/D->groups;
+    D->ws->owner=nullptr;
+
+    // one task per sample (and tile with mem_level 2)
+    #pragma omp parallel for collapse(2)
+    for(int b=0;b<D->I->shape[0];b++){
+      for(int t=0;t<tiles;t++){
+        int j0=t*rows;
+        int n=std::min(rows,orsize-j0);
+        float *slot=ws+(size_t)((D->mem_level==0) ? b : conv_thread())*rows*lcols*D->groups;
+
+        // group g: its kz input channels times its ng kernels
+        for(int g=0;g<D->groups;g++){
+          float *ptrI=slot+(size_t)g*rows*lcols;
+
+          Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,n,lcols);
+          Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr+(size_t)g*lcols*ng,lcols,ng);
+          StridedMap matO(D->O->ptr+(size_t)b*D->O->stride[0]+(g*ng*orsize)+j0,n,ng,Eigen::OuterStride<>(orsize));
+
+          im2col(b,D,ptrI,0,j0,j0+n,g);
+
+          matO.noalias()=matI*matK;
+        }
+      }
+    }// batch
+
+    // the lowered batch stays there until another layer uses the workspace
+    if (D->mem_level==0) D->ws->owner=D;
+  }
 
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matO=Eigen::Map<Eigen::MatrixXf>(ptrO,D->r*D->c,D->z);
+  //bias (and fused activation)
+  if ((D->use_bias)||(D->fused_act!=FUSED_ACT_NONE)) {
+    cpu_bias_act(D->O, D->use_bias ? D->bias : nullptr, D->fused_act);
+  }
+  _profile(_CPU_CONV2D, 1);
 
-    im2col(b,D,ptrI,0);
+}
 
-    matO=matI*D->matK;
-  }// batch
+static void conv2D_grad_bias(ConvolDescriptor *D)
+{
+  int orsize=D->r*D->c;
 
-  //bias
   if (D->use_bias) {
     #pragma omp parallel for
-    for(int b=0;b<D->O->shape[0];b++) {
-      float *ptrO=D->O->ptr+(b*osize);
-      for(int z=0;z<D->O->shape[1];z++)
-      for(int r=0;r<D->O->shape[2];r++)
-      for(int c=0;c<D->O->shape[3];c++,ptrO++)
-      (*ptrO)+=D->bias->ptr[z];
+    for(int z=0;z<D->z;z++) {
+      float sum=0.0f;
+      for(int b=0;b<D->I->shape[0];b++) {
+        const float *ptrD=D->D->ptr+(size_t)b*D->D->stride[0]+(z*orsize);
+        for(int i=0;i<orsize;i++) sum+=ptrD[i];
+      }
+      D->gbias->ptr[z]+=sum;
     }
   }
-    _profile(_CPU_CONV2D, 1);
-
 }
 
 void cpu_conv2D_grad(ConvolDescriptor *D)
 {
   _profile(_CPU_CONV2D_GRAD, 0);
   //return;
-  int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
+  int orsize=D->r*D->c;
+  int lcols=D->kc*D->kr*D->kz;
+  int iisize=D->iz*D->ir*D->ic;
+  int ksize=D->kr*D->kc*D->kz*D->nk;
+  int batch=D->I->shape[0];
+  int ng=D->nk/D->groups;
+
+  if (D->cpu_algo==CONV_ALGO_DEPTHWISE) {
+    cpu_conv2D_grad_depthwise(D);
+    conv2D_grad_bias(D);
+    _profile(_CPU_CONV2D_GRAD, 1);
+    return;
+  }
 
   // Map memory to Eigen
   new(&D->matgK) Eigen::Map<Eigen::MatrixXf>(D->gK->ptr, D->kr * D->kc * D->kz, D->nk);
 
-  //#pragma omp parallel for
-  for(int b=0;b<D->I->shape[0];b++){
-
-    float *ptrD=D->D->ptr+(b*osize);
-    float *ptrI=D->ptrI+(b*isize);
-
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,D->z);
-
-    D->matgK+=matI.transpose()*matD;
-  }// batch
-
-  //bias
+  // One partial gradient per thread (contiguous batch chunks), reduced as a tree
+#ifdef _OPENMP
+  int nparts=std::max(1,std::min(omp_get_max_threads(),batch));
+#else
+  int nparts=1;
+#endif
+  float *ptrP=(nparts>1) ? get_fmem(nparts*ksize,"cpu_conv2D_grad") : nullptr;
+
+  // The lowered batch of the forward is reused if still in the workspace,
+  // otherwise (Winograd, mem_level>0, shared workspace) it is built again
+  bool direct=(D->cpu_algo==CONV_ALGO_DIRECT_1X1);
+  float *ws=direct ? nullptr : D->workspace();
+  bool kept=(!direct)&&(D->ws->owner==D);
+  if ((!direct)&&(!kept)) D->ws->owner=nullptr;
+  int rows=D->lowering_rows();
+  int tiles=(orsize+rows-1)/rows;
+
+  #pragma omp parallel for schedule(static)
+  for(int part=0;part<nparts;part++){
+    Eigen::Map<Eigen::MatrixXf> matP=Eigen::Map<Eigen::MatrixXf>((nparts>1) ? ptrP+(part*ksize) : D->gK->ptr, D->kr*D->kc*D->kz, D->nk);
+    if (nparts>1) matP.setZero();
+
+    for(int b=(part*batch)/nparts;b<((part+1)*batch)/nparts;b++){
+      float *ptrD=D->D->ptr+(size_t)b*D->D->stride[0];
+
+      if (direct) {
+        Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(D->I->ptr+(b*iisize),orsize,lcols);
+        Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,orsize,D->z);
+        matP.noalias()+=matI.transpose()*matD;
+        continue;
+      }
+
+      for(int t=0;t<tiles;t++){
+        int j0=t*rows;
+        int n=std::min(rows,orsize-j0);
+        float *slot=ws+(size_t)(kept ? b : conv_thread())*rows*lcols*D->groups;
+
+        for(int g=0;g<D->groups;g++){
+          float *ptrI=slot+(size_t)g*rows*lcols;
+
+          if (!kept) im2col(b,D,ptrI,0,j0,j0+n,g);
+
+          Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,n,lcols);
+          StridedMap matD(ptrD+(g*ng*orsize)+j0,n,ng,Eigen::OuterStride<>(orsize));
+
+          matP.middleCols(g*ng,ng).noalias()+=matI.transpose()*matD;
+        }
+      }
+    }// batch
+  }// parts
+
+  if (nparts>1) {
+    for(int step=1;step<nparts;step*=2) {
+      #pragma omp parallel for
+      for(int part=0;part<nparts-step;part+=2*step) {
+        float *dst=ptrP+(part*ksize);
+        const float *src=ptrP+((part+step)*ksize);
+        for(int i=0;i<ksize;i++) dst[i]+=src[i];
+      }
+    }
 
-  //#pragma omp parallel for
-  if (D->use_bias) {
-    for(int b=0;b<D->D->shape[0];b++) {
-      float *ptrD=D->D->ptr+(b*osize);
-      for(int z=0;z<D->D->shape[1];z++)
-      for(int r=0;r<D->D->shape[2];r++)
-      for(int c=0;c<D->D->shape[3];c++,ptrD++)
-      D->gbias->ptr[z]+=(*ptrD);
+    #pragma omp parallel for
+    for(int i=0;i<ksize;i++) D->gK->ptr[i]+=ptrP[i];
 
-    }
+    free_fmem(ptrP);
   }
+
+  conv2D_grad_bias(D);
     _profile(_CPU_CONV2D_GRAD, 1);
 }
 
 void cpu_conv2D_back(ConvolDescriptor *D)
 {
   _profile(_CPU_CONV2D_BACK, 0);
-  int osize=D->z*D->r*D->c;
-  int isize=D->r*D->c*D->kc*D->kr*D->kz;//r*c,kr*kc*kz
-
-  float *ptrD=D->D->ptr;
-  float *ptrI=D->ptrI;
+  int orsize=D->r*D->c;
+  int lcols=D->kc*D->kr*D->kz;
 
   // Map memory to Eigen
   new(&D->matK) Eigen::Map<Eigen::MatrixXf>(D->K->ptr, D->kr * D->kc * D->kz, D->nk);
-  new (&(D->matI)) Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
 
-  #pragma omp parallel for
-  for(int b=0;b<D->I->shape[0];b++){
+  if (D->cpu_algo==CONV_ALGO_DEPTHWISE) {
+    cpu_conv2D_back_depthwise(D);
+  }
+  else if (D->cpu_algo==CONV_ALGO_DIRECT_1X1) {
+    int iisize=D->iz*D->ir*D->ic;
 
-    float *ptrD=D->D->ptr+(b*osize);
-    float *ptrI=D->ptrI+(b*isize);
+    #pragma omp parallel for
+    for(int b=0;b<D->I->shape[0];b++){
+      Eigen::Map<Eigen::MatrixXf> matID=Eigen::Map<Eigen::MatrixXf>(D->ID->ptr+(b*iisize),D->r*D->c,D->kz);
+      Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(D->D->ptr+(size_t)b*D->D->stride[0],D->r*D->c,D->z);
 
-    Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,D->r*D->c,D->kz*D->kr*D->kc);
-    Eigen::Map<Eigen::MatrixXf> matD=Eigen::Map<Eigen::MatrixXf>(ptrD,D->r*D->c,D->z);
+      matID.noalias()+=matD*D->matK.transpose();
+    }// batch
+  }
+  else {
+    // The workspace is scratch here: the lowered delta of each tile is added
+    // back to ID (one sample per thread, so the tiles of a sample do not race)
+    float *ws=D->workspace();
+    int rows=D->lowering_rows();
+    int ng=D->nk/D->groups;
+    D->ws->owner=nullptr;
 
-    matI=matD*D->matK.transpose();
+    #pragma omp parallel for
+    for(int b=0;b<D->I->shape[0];b++){
+      float *ptrI=ws+(size_t)conv_thread()*rows*lcols*D->groups;
+
+      for(int j0=0;j0<orsize;j0+=rows){
+        int n=std::min(rows,orsize-j0);
 
-    im2col(b,D,ptrI,1);
+        for(int g=0;g<D->groups;g++){
+          Eigen::Map<Eigen::MatrixXf> matI=Eigen::Map<Eigen::MatrixXf>(ptrI,n,lcols);
+          Eigen::Map<Eigen::MatrixXf> matK=Eigen::Map<Eigen::MatrixXf>(D->K->ptr+(size_t)g*lcols*ng,lcols,ng);
+          StridedMap matD(D->D->ptr+(size_t)b*D->D->stride[0]+(g*ng*orsize)+j0,n,ng,Eigen::OuterStride<>(orsize));
 
-  }// batch
+          matI.noalias()=matD*matK.transpose();
+
+          im2col(b,D,ptrI,1,j0,j0+n,g);
+        }
+      }
+    }// batch
+  }
     _profile(_CPU_CONV2D_BACK, 1);
 }
+
+
+// Transposed convolutions. D is the direct convolution from the output of the
+// transposed one (D->I, delta of the layer in backward) to its input (D->D):
+// the forward is the col2im of D->D into D->ID, the delta is a convolution
+// of the delta of the layer and the gradient is the one of D
+void cpu_conv2DT(ConvolDescriptor *D, Tensor *bias)
+{
+  _profile(_CPU_CONV2DT, 0);
+  std::fill(D->ID->ptr,D->ID->ptr+D->ID->size,0.0f);
+  cpu_conv2D_back(D);
+
+  if (bias!=nullptr) cpu_bias_act(D->ID, bias, FUSED_ACT_NONE);
+  _profile(_CPU_CONV2DT, 1);
+}
+
+void cpu_conv2DT_grad(ConvolDescriptor *D, Tensor *gbias)
+{
+  _profile(_CPU_CONV2DT_GRAD, 0);
+  cpu_conv2D_grad(D);
+
+  // bias of the output channels (the input ones of D)
+  if (gbias!=nullptr) {
+    int irsize=D->ir*D->ic;
+
+    #pragma omp parallel for
+    for(int z=0;z<D->iz;z++) {
+      float sum=0.0f;
+      for(int b=0;b<D->I->shape[0];b++) {
+        const float *ptrI=D->I->ptr+((size_t)b*D->iz+z)*irsize;
+        #pragma omp simd reduction(+:sum)
+        for(int i=0;i<irsize;i++) sum+=ptrI[i];
+      }
+      gbias->ptr[z]+=sum;
+    }
+  }
+  _profile(_CPU_CONV2DT_GRAD, 1);
+}
+
+void cpu_conv2DT_back(ConvolDescriptor *D, Tensor *PD)
+{
+  _profile(_CPU_CONV2DT_BACK, 0);
+  // D->O is the buffer of the delta, PD may have other children
+  cpu_conv2D(D);
+
+  #pragma omp parallel for simd
+  for(int i=0;i<PD->size;i++) PD->ptr[i]+=D->O->ptr[i];
+  _profile(_CPU_CONV2DT_BACK, 1);
+}
@@ -25,3 +25,24 @@ void cpu_cent(Tensor *A, Tensor *B, Tensor *C){
   }
     _profile(_CPU_CENT, 1);
 }
+
+float cpu_soft_cent(Tensor *T, Tensor *Y, Tensor *D){
+  _profile(_CPU_SOFT_CENT, 0);
+  // Softmax + cross-entropy: the delta w.r.t. the logits is (Y-T)/batch
+  float inv = 1.0f / (float)T->shape[0];
+  double loss = 0.0;
+
+  #pragma omp parallel for reduction(+:loss)
+  for (int i = 0; i < T->size; i++) {
+    float t = T->ptr[i], y = Y->ptr[i];
+    D->ptr[i] = (y - t) * inv;
+
+    // Same terms as cpu_cent
+    float c = 0.0f;
+    if (t != 0.0f) c -= t * std::log(y+0.00001f);
+    if (t != 1.0f) c -= (1.0f - t) * std::log(1.0f - y+0.00001f);
+    loss += c;
+  }
+    _profile(_CPU_SOFT_CENT, 1);
+  return (float)loss;
+}
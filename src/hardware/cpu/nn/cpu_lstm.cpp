@@ -0,0 +1,197 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>      /* printf, scanf, NULL */
+#include <cstdlib>     /* malloc, free, rand */
+#include <cstring>
+#include <cmath>
+#include <iostream>
+
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+// Gates are packed as [i | f | o | c], each block of "units" columns
+
+// Rows of X made only of zeros are masked (the state is kept)
+static void lstm_mask(Tensor *X, char *mask){
+  int d=X->shape[1];
+
+  #pragma omp parallel for
+  for(int b=0;b<X->shape[0];b++) {
+    float *px=X->ptr+b*d;
+    float s=0.0;
+    for(int j=0;j<d;j++) s+=std::fabs(px[j]);
+    mask[b]=(s==0.0);
+  }
+}
+
+
+void cpu_lstm_pack(vector<Tensor *> W, Tensor *P){
+  _profile(_CPU_LSTM_PACK, 0);
+  int u=W[0]->size/P->shape[0];
+  int cols=W.size()*u;
+
+  #pragma omp parallel for
+  for(int i=0;i<P->shape[0];i++)
+    for(int k=0;k<W.size();k++)
+      memcpy(P->ptr+i*cols+k*u,W[k]->ptr+i*u,u*sizeof(float));
+  _profile(_CPU_LSTM_PACK, 1);
+}
+
+
+void cpu_lstm_cell(Tensor *G, Tensor *bias, Tensor *X, Tensor *prev_h, Tensor *prev_c, Tensor *H, Tensor *C, Tensor *SH){
+  _profile(_CPU_LSTM_CELL, 0);
+  int batch=H->shape[0];
+  int u=H->shape[1];
+
+  char *mask=nullptr;
+  if (X!=nullptr) {
+    mask=new char[batch];
+    lstm_mask(X,mask);
+  }
+
+  #pragma omp parallel for
+  for(int b=0;b<batch;b++) {
+    float *g=G->ptr+b*4*u;
+    float *h=H->ptr+b*u;
+    float *c=C->ptr+b*u;
+    float *sh=SH->ptr+b*u;
+    float *pc=(prev_c!=nullptr) ? prev_c->ptr+b*u : nullptr;
+
+    if ((mask!=nullptr)&&(mask[b])) {
+      // output=prev output when in=0
+      for(int j=0;j<u;j++) {
+        h[j]=(prev_h!=nullptr) ? prev_h->ptr[b*u+j] : 0.0f;
+        c[j]=(pc!=nullptr) ? pc[j] : 0.0f;
+      }
+      continue;
+    }
+
+    float *bias_p=bias->ptr;
+    #pragma omp simd
+    for(int j=0;j<u;j++) {
+      float in=cpu_sigmoid_f(g[j]+bias_p[j]);
+      float fn=cpu_sigmoid_f(g[u+j]+bias_p[u+j]);
+      float on=cpu_sigmoid_f(g[2*u+j]+bias_p[2*u+j]);
+      float cn=cpu_tanh_f(g[3*u+j]+bias_p[3*u+j]);
+
+      // activations are kept for backward
+      g[j]=in; g[u+j]=fn; g[2*u+j]=on; g[3*u+j]=cn;
+      c[j]=in*cn;
+    }
+
+    if (pc!=nullptr) {
+      #pragma omp simd
+      for(int j=0;j<u;j++)
+        c[j]+=g[u+j]*pc[j];
+    }
+
+    #pragma omp simd
+    for(int j=0;j<u;j++) {
+      sh[j]=cpu_tanh_f(c[j]);
+      h[j]=g[2*u+j]*sh[j];
+    }
+  }
+
+  delete[] mask;
+  _profile(_CPU_LSTM_CELL, 1);
+}
+
+
+void cpu_d_lstm_cell(Tensor *G, Tensor *SH, Tensor *X, Tensor *prev_c, Tensor *DH, Tensor *DC, Tensor *prev_dh, Tensor *prev_dc){
+  _profile(_CPU_D_LSTM_CELL, 0);
+  int batch=DH->shape[0];
+  int u=DH->shape[1];
+
+  char *mask=nullptr;
+  if (X!=nullptr) {
+    mask=new char[batch];
+    lstm_mask(X,mask);
+  }
+
+  #pragma omp parallel for
+  for(int b=0;b<batch;b++) {
+    float *g=G->ptr+b*4*u;
+    float *sh=SH->ptr+b*u;
+    float *dh=DH->ptr+b*u;
+    float *dc=DC->ptr+b*u;
+
+    if ((mask!=nullptr)&&(mask[b])) {
+      // state was copied from the previous step, so is its delta
+      for(int j=0;j<4*u;j++) g[j]=0.0f;
+      if (prev_dh!=nullptr)
+        for(int j=0;j<u;j++) {
+          prev_dh->ptr[b*u+j]+=dh[j];
+          prev_dc->ptr[b*u+j]+=dc[j];
+        }
+      continue;
+    }
+
+    #pragma omp simd
+    for(int j=0;j<u;j++) {
+      float in=g[j], on=g[2*u+j], cn=g[3*u+j];
+
+      // delta of the cell state (kept in DC)
+      dc[j]+=dh[j]*on*(1.0f-sh[j]*sh[j]);
+
+      g[j]=dc[j]*cn*in*(1.0f-in);
+      g[2*u+j]=dh[j]*sh[j]*on*(1.0f-on);
+      g[3*u+j]=dc[j]*in*(1.0f-cn*cn);
+    }
+
+    // forget gate
+    if (prev_c!=nullptr) {
+      float *pc=prev_c->ptr+b*u;
+      float *pdc=prev_dc->ptr+b*u;
+      #pragma omp simd
+      for(int j=0;j<u;j++) {
+        float fn=g[u+j];
+        pdc[j]+=dc[j]*fn;
+        g[u+j]=dc[j]*pc[j]*fn*(1.0f-fn);
+      }
+    }
+    else {
+      for(int j=0;j<u;j++) g[u+j]=0.0f;
+    }
+  }
+
+  delete[] mask;
+  _profile(_CPU_D_LSTM_CELL, 1);
+}
+
+
+void cpu_lstm_grad(Tensor *A, Tensor *DG, vector<Tensor *> gW){
+  _profile(_CPU_LSTM_GRAD, 0);
+  int batch=DG->shape[0];
+  int u=DG->shape[1]/gW.size();
+
+  if (A!=nullptr) {
+    // gW_k += A^T x DG_k, reading the gate block in place (no scatter)
+    int r=A->shape[1];
+    Eigen::Map<Eigen::MatrixXf> matA(A->ptr,r,batch);
+    for(int k=0;k<gW.size();k++) {
+      Eigen::Map<Eigen::MatrixXf,0,Eigen::OuterStride<>> matD(DG->ptr+k*u,u,batch,Eigen::OuterStride<>(DG->shape[1]));
+      Eigen::Map<Eigen::MatrixXf> matW(gW[k]->ptr,u,r);
+      matW.noalias()+=matD*matA.transpose();
+    }
+  }
+  else {
+    // bias
+    #pragma omp parallel for
+    for(int k=0;k<gW.size();k++) {
+      float *gb=gW[k]->ptr;
+      for(int b=0;b<batch;b++) {
+        float *dg=DG->ptr+b*DG->shape[1]+k*u;
+        #pragma omp simd
+        for(int j=0;j<u;j++) gb[j]+=dg[j];
+      }
+    }
+  }
+  _profile(_CPU_LSTM_GRAD, 1);
+}
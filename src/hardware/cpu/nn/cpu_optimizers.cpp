@@ -0,0 +1,137 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>      /* printf, scanf, NULL */
+#include <cstdlib>     /* malloc, free, rand */
+#include <iostream>
+#include <cmath>
+
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+
+// Single pass Adam: reads grad/m/v/param once and writes m/v/param once.
+// With decoupled=true the weight decay is applied to the parameters (AdamW),
+// otherwise it is added to the gradient as an L2 penalty.
+void cpu_adam(Tensor *P, Tensor *G, Tensor *M, Tensor *V, float lr, float beta_1, float beta_2, float epsilon,
+              float weight_decay, bool decoupled, int t){
+  _profile(_CPU_ADAM, 0);
+  const float bc1 = 1.0f / (1.0f - std::pow(beta_1, (float)t));
+  const float bc2 = 1.0f / (1.0f - std::pow(beta_2, (float)t));
+  const float l2 = decoupled ? 0.0f : weight_decay;
+  const float decay = decoupled ? (1.0f - lr * weight_decay) : 1.0f;
+
+  float *__restrict__ p = P->ptr;
+  float *__restrict__ m = M->ptr;
+  float *__restrict__ v = V->ptr;
+  const float *__restrict__ g = G->ptr;
+  const int size = P->size;
+
+  #pragma omp parallel for simd
+  for (int i = 0; i < size; i++) {
+    float gi = g[i] + l2 * p[i];
+    float mi = beta_1 * m[i] + (1.0f - beta_1) * gi;
+    float vi = beta_2 * v[i] + (1.0f - beta_2) * gi * gi;
+    m[i] = mi;
+    v[i] = vi;
+    p[i] = decay * p[i] - lr * (mi * bc1) / std::sqrt(vi * bc2 + epsilon);
+  }
+  _profile(_CPU_ADAM, 1);
+}
+
+
+// Row-sparse ("lazy") updates: only the rows listed in "rows" are read and
+// written, the rest of P and of the optimizer state are left as they are.
+// P, G and the state tensors are {rows,d} matrices.
+
+void cpu_zero_rows(Tensor *A, const vector<int> &rows){
+  _profile(_CPU_ZERO_ROWS, 0);
+  const int d = A->size / A->shape[0];
+
+  #pragma omp parallel for
+  for (int i = 0; i < rows.size(); i++) {
+    float *a = A->ptr + (size_t)rows[i] * d;
+    #pragma omp simd
+    for (int j = 0; j < d; j++) a[j] = 0.0f;
+  }
+  _profile(_CPU_ZERO_ROWS, 1);
+}
+
+void cpu_sgd_rows(Tensor *P, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu){
+  _profile(_CPU_SGD_ROWS, 0);
+  const int d = P->size / P->shape[0];
+
+  #pragma omp parallel for
+  for (int i = 0; i < rows.size(); i++) {
+    size_t o = (size_t)rows[i] * d;
+    float *__restrict__ p = P->ptr + o;
+    float *__restrict__ m = M->ptr + o;
+    const float *__restrict__ g = G->ptr + o;
+
+    #pragma omp simd
+    for (int j = 0; j < d; j++) {
+      m[j] = lr * g[j] + mu * m[j];
+      p[j] -= m[j];
+    }
+  }
+  _profile(_CPU_SGD_ROWS, 1);
+}
+
+// Same step as cpu_adam; the bias correction uses the global step t
+void cpu_adam_rows(Tensor *P, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1,
+                   float beta_2, float epsilon, float weight_decay, bool decoupled, int t){
+  _profile(_CPU_ADAM_ROWS, 0);
+  const float bc1 = 1.0f / (1.0f - std::pow(beta_1, (float)t));
+  const float bc2 = 1.0f / (1.0f - std::pow(beta_2, (float)t));
+  const float l2 = decoupled ? 0.0f : weight_decay;
+  const float decay = decoupled ? (1.0f - lr * weight_decay) : 1.0f;
+  const int d = P->size / P->shape[0];
+
+  #pragma omp parallel for
+  for (int i = 0; i < rows.size(); i++) {
+    size_t o = (size_t)rows[i] * d;
+    float *__restrict__ p = P->ptr + o;
+    float *__restrict__ m = M->ptr + o;
+    float *__restrict__ v = V->ptr + o;
+    const float *__restrict__ g = G->ptr + o;
+
+    #pragma omp simd
+    for (int j = 0; j < d; j++) {
+      float gj = g[j] + l2 * p[j];
+      float mj = beta_1 * m[j] + (1.0f - beta_1) * gj;
+      float vj = beta_2 * v[j] + (1.0f - beta_2) * gj * gj;
+      m[j] = mj;
+      v[j] = vj;
+      p[j] = decay * p[j] - lr * (mj * bc1) / std::sqrt(vj * bc2 + epsilon);
+    }
+  }
+  _profile(_CPU_ADAM_ROWS, 1);
+}
+
+// Same step as RMSProp::applygrads, G1 keeps the previous gradient of each row
+void cpu_rmsprop_rows(Tensor *P, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon){
+  _profile(_CPU_RMSPROP_ROWS, 0);
+  const int d = P->size / P->shape[0];
+
+  #pragma omp parallel for
+  for (int i = 0; i < rows.size(); i++) {
+    size_t o = (size_t)rows[i] * d;
+    float *__restrict__ p = P->ptr + o;
+    float *__restrict__ g1 = G1->ptr + o;
+    const float *__restrict__ g = G->ptr + o;
+
+    #pragma omp simd
+    for (int j = 0; j < d; j++) {
+      float s = (1.0f - rho) * g[j] * g[j] + rho * g1[j] * g1[j];
+      p[j] -= lr * g[j] / std::sqrt(s + epsilon);
+      g1[j] = g[j];
+    }
+  }
+  _profile(_CPU_RMSPROP_ROWS, 1);
+}
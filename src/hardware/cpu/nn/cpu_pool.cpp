@@ -16,130 +16,220 @@
 
 #include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
 
+// The kernels work plane by plane (batch x depth). Each output row is split in
+// the columns whose window touches the padding (border, checked pixel by pixel)
+// and the rest (interior), which is vectorized across the output columns.
+// Padding pixels count as zeros, as in the GPU kernels.
+
+
+// Range [lo, hi] of outputs whose window lies fully inside the input. If there
+// is none it is [n_out, n_out-1]: empty, and lo is never reached by the loops
+static void interior_range(int n_out, int n_in, int k, int s, int pad, int &lo, int &hi){
+    lo = (pad + s - 1) / s;
+    hi = (n_in - k + pad) >= 0 ? (n_in - k + pad) / s : -1;
+    if (hi > n_out - 1) hi = n_out - 1;
+    if (lo > hi) { lo = n_out; hi = n_out - 1; }
+}
+
+static inline void mpool_border(const float *in, int base, PoolDescriptor *D, int i, int j, float &max, int &arg){
+    max = -std::numeric_limits<float>::infinity();
+    arg = -1;
+    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+        int y = i + ki;
+        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+            int x = j + kj;
+            float v = 0.0f;
+            int a = -1;  // Padding: no gradient
+            if (y >= 0 && y < D->ir && x >= 0 && x < D->ic) {
+                v = in[y*D->ic + x];
+                a = base + y*D->ic + x;
+            }
+            if (v > max) { max = v; arg = a; }
+        }
+    }
+}
+
+static inline float avgpool_border(const float *in, PoolDescriptor *D, int i, int j){
+    float sum = 0.0f;
+    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+        int y = i + ki;
+        if (y < 0 || y >= D->ir) continue;
+        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+            int x = j + kj;
+            if (x >= 0 && x < D->ic) sum += in[y*D->ic + x];
+        }
+    }
+    return sum;
+}
+
+static inline void avgpool_back_border(float *gin, PoolDescriptor *D, int i, int j, float g){
+    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+        int y = i + ki;
+        if (y < 0 || y >= D->ir) continue;
+        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+            int x = j + kj;
+            if (x >= 0 && x < D->ic) gin[y*D->ic + x] += g;
+        }
+    }
+}
+
 
 void cpu_mpool2D(PoolDescriptor *D){
     _profile(_CPU_MPOOL2D, 0);
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size;  // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
-
-                    // Get max value in window
-                    float max = std::numeric_limits<float>::min();
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-
-                            // Get value W[ki,kj] value in window
-                            float v = get_pixel(b,j+kj,i+ki, k, D, isize, irsize);
-                            if (v>max) {
-                                max = v;
-                                D->indX->ptr[p] = j+kj;
-                                D->indY->ptr[p] = i+ki;
-                            }
-
-                        } // kernel cols
-                    }  // kernel rows
-
-                    // Set output value
-                    D->O->ptr[p] = max;
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const int planes = D->I->shape[0]*D->iz;
+    int r_lo, r_hi, c_lo, c_hi;
+    interior_range(D->r, D->ir, D->kr, D->sr, D->padrt, r_lo, r_hi);
+    interior_range(D->c, D->ic, D->kc, D->sc, D->padcl, c_lo, c_hi);
+
+    #pragma omp parallel for
+    for(int pl=0; pl<planes; pl++){  // Batches x Depth
+        const int base = pl*irsize;
+        const float *in = D->I->ptr + base;
+
+        for(int orow=0; orow<D->r; orow++) {  // rows: top-bottom
+            const int i = -D->padrt + orow*D->sr;
+            float *out = D->O->ptr + pl*orsize + orow*D->c;
+            int *ind = D->indI + pl*orsize + orow*D->c;
+
+            int lo = c_lo, hi = c_hi;
+            if (orow < r_lo || orow > r_hi) { lo = D->c; hi = D->c - 1; }  // The whole row is border
+
+            for(int ocol=0; ocol<D->c; ocol++) {  // cols: left-right
+                if (ocol == lo) { ocol = hi; continue; }
+                mpool_border(in, base, D, i, -D->padcl + ocol*D->sc, out[ocol], ind[ocol]);
+            }
+
+            if (lo > hi) continue;
+
+            // Interior: no bounds checks, vectorized across the output columns
+            for(int ocol=lo; ocol<=hi; ocol++) {
+                out[ocol] = -std::numeric_limits<float>::infinity();
+                ind[ocol] = -1;
+            }
+            for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+                const int roff = (i + ki)*D->ic - D->padcl;
+                const float *row = in + (i + ki)*D->ic;
+                for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+                    #pragma omp simd
+                    for(int ocol=lo; ocol<=hi; ocol++) {
+                        const int x = ocol*D->sc - D->padcl + kj;
+                        const float v = row[x];
+                        if (v > out[ocol]) {
+                            out[ocol] = v;
+                            ind[ocol] = base + roff + D->padcl + x;
+                        }
+                    }
+                }
+            }
+        } // rows
+    } // planes
     _profile(_CPU_MPOOL2D, 1);
 }
 
 void cpu_mpool2D_back(PoolDescriptor *D){
     _profile(_CPU_MPOOL2D_BACK, 0);
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches (ob=ib)
-        int p=b*D->size; // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back (oz=iz)
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
-
-                    int x = D->indX->ptr[p];  // previous: j+kj
-                    int y = D->indY->ptr[p];  // previous: i+ki
-                    add_pixel(b, x, y, k, D, isize, irsize, D->D->ptr[p]);  // Set input's delta
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+    const int orsize = D->r*D->c;
+    const int planes = D->I->shape[0]*D->iz;
+
+    // Each window of a plane only touches that plane of the input: no races
+    #pragma omp parallel for
+    for(int pl=0; pl<planes; pl++){  // Batches x Depth
+        const int *ind = D->indI + pl*orsize;
+        const float *delta = D->D->ptr + pl*orsize;
+        for(int p=0; p<orsize; p++) {
+            if (ind[p] >= 0) D->ID->ptr[ind[p]] += delta[p];  // Set input's delta
+        }
+    }
     _profile(_CPU_MPOOL2D_BACK, 1);
 }
 
 void cpu_avgpool2D(PoolDescriptor *D){
     _profile(_CPU_AVGPOOL2D, 0);
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-    int ksize = D->kr*D->kc;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize, ksize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size; // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc, p++) { // cols: left-right
-
-                    // Sum values window
-                    float sum = 0.0f;
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-
-                            // Get value W[ki,kj] value in window
-                            float v = get_pixel(b,j+kj,i+ki, k, D, isize, irsize);
-                            sum += v;
-
-                        } // kernel cols
-                    }  // kernel rows
-
-                    // Set output value
-                    D->O->ptr[p]= sum/(float)ksize;
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const int planes = D->I->shape[0]*D->iz;
+    const float ksize = (float)(D->kr*D->kc);
+    int r_lo, r_hi, c_lo, c_hi;
+    interior_range(D->r, D->ir, D->kr, D->sr, D->padrt, r_lo, r_hi);
+    interior_range(D->c, D->ic, D->kc, D->sc, D->padcl, c_lo, c_hi);
+
+    #pragma omp parallel for
+    for(int pl=0; pl<planes; pl++){  // Batches x Depth
+        const float *in = D->I->ptr + pl*irsize;
+
+        for(int orow=0; orow<D->r; orow++) {  // rows: top-bottom
+            const int i = -D->padrt + orow*D->sr;
+            float *out = D->O->ptr + pl*orsize + orow*D->c;
+
+            int lo = c_lo, hi = c_hi;
+            if (orow < r_lo || orow > r_hi) { lo = D->c; hi = D->c - 1; }  // The whole row is border
+
+            for(int ocol=0; ocol<D->c; ocol++) {  // cols: left-right
+                if (ocol == lo) { ocol = hi; continue; }
+                out[ocol] = avgpool_border(in, D, i, -D->padcl + ocol*D->sc) / ksize;
+            }
+
+            if (lo > hi) continue;
+
+            // Interior: no bounds checks, vectorized across the output columns
+            for(int ocol=lo; ocol<=hi; ocol++) out[ocol] = 0.0f;
+            for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+                const float *row = in + (i + ki)*D->ic;
+                for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+                    #pragma omp simd
+                    for(int ocol=lo; ocol<=hi; ocol++) {
+                        out[ocol] += row[ocol*D->sc - D->padcl + kj];
+                    }
+                }
+            }
+            for(int ocol=lo; ocol<=hi; ocol++) out[ocol] /= ksize;
+        } // rows
+    } // planes
     _profile(_CPU_AVGPOOL2D, 1);
 }
 
 void cpu_avgpool2D_back(PoolDescriptor *D){
     _profile(_CPU_AVGPOOL2D_BACK, 0);
-    int isize = D->ir*D->ic*D->iz;
-    int irsize = D->ir*D->ic;
-    int ksize = D->kr*D->kc;
-
-    #pragma omp parallel for default(none) shared(D, isize, irsize, ksize)
-    for(int b=0; b<D->I->shape[0]; b++){  // Batches
-        int p=b*D->size; // Kernel's index (opt. shared variable)
-
-        for(int k=0; k<D->iz; k++) { // Depth: front-back
-            for(int i=-D->padrt; i<=D->ir+D->padrb-D->kr; i+=D->sr) {  // rows: top-bottom
-                for(int j=-D->padcl; j<=D->ic+D->padcr-D->kc; j+=D->sc,p++) { // cols: left-right
-
-                    // Walk kernel window to equally distribute the delta among all the elements
-                    for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
-                        for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
-                            add_pixel(b, j + kj, i + ki, k, D, isize, irsize, D->D->ptr[p]/(float)ksize);
-                        } // kernel cols
-                    }  // kernel rows
-
-                } // cols
-            } // rows
-        } // depth
-    } // batch
+    const int irsize = D->ir*D->ic;
+    const int orsize = D->r*D->c;
+    const int planes = D->I->shape[0]*D->iz;
+    const float ksize = (float)(D->kr*D->kc);
+    int r_lo, r_hi, c_lo, c_hi;
+    interior_range(D->r, D->ir, D->kr, D->sr, D->padrt, r_lo, r_hi);
+    interior_range(D->c, D->ic, D->kc, D->sc, D->padcl, c_lo, c_hi);
+
+    // Each window of a plane only touches that plane of the input: no races
+    #pragma omp parallel for
+    for(int pl=0; pl<planes; pl++){  // Batches x Depth
+        float *gin = D->ID->ptr + pl*irsize;
+
+        for(int orow=0; orow<D->r; orow++) {  // rows: top-bottom
+            const int i = -D->padrt + orow*D->sr;
+            const float *delta = D->D->ptr + pl*orsize + orow*D->c;
+
+            int lo = c_lo, hi = c_hi;
+            if (orow < r_lo || orow > r_hi) { lo = D->c; hi = D->c - 1; }  // The whole row is border
+
+            for(int ocol=0; ocol<D->c; ocol++) {  // cols: left-right
+                if (ocol == lo) { ocol = hi; continue; }
+                avgpool_back_border(gin, D, i, -D->padcl + ocol*D->sc, delta[ocol]/ksize);
+            }
+
+            if (lo > hi) continue;
+
+            // Interior: for a fixed kernel tap every output column hits a different pixel
+            for(int ki=0; ki<D->kr; ki++){  // rows (kernel): top-bottom
+                float *row = gin + (i + ki)*D->ic;
+                for(int kj=0; kj<D->kc; kj++) { // cols (kernel): left-right
+                    #pragma omp simd
+                    for(int ocol=lo; ocol<=hi; ocol++) {
+                        row[ocol*D->sc - D->padcl + kj] += delta[ocol]/ksize;
+                    }
+                }
+            }
+        } // rows
+    } // planes
     _profile(_CPU_AVGPOOL2D_BACK, 1);
 }
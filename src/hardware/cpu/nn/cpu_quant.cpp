@@ -0,0 +1,259 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>      /* printf, scanf, NULL */
+#include <cstdlib>     /* malloc, free, rand */
+#include <cstdint>
+#include <iostream>
+#include <algorithm>
+#include <vector>
+
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+#include "eddl/hardware/cpu/cpu_half.h"
+
+// Rows of the input computed per task (times QUANT_BLOCK output channels)
+#define QUANT_ROWS 64
+
+// The int8 (and float) dot products are plain loops vectorized by the compiler. On x86-64
+// an AVX2 version is also built, the fastest one is picked at load time.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define QUANT_TARGETS __attribute__((target_clones("avx2","default")))
+#else
+#define QUANT_TARGETS
+#endif
+
+
+// Quantized inputs are kept in int16 with the zero point already removed:
+// v=clamp(round(x/scale),-zero,255-zero) and x~=v*scale
+static inline int16_t quant_in(float x, float inv, int lo, int hi) {
+  float v = x * inv;
+  int q = (int)(v + ((v >= 0.0f) ? 0.5f : -0.5f));
+  return (int16_t)std::max(lo, std::min(hi, q));
+}
+
+static inline float quant_act(float x, int act) {
+  if (act == FUSED_ACT_RELU) return std::max(x, 0.0f);
+  if (act == FUSED_ACT_SIGMOID) return cpu_sigmoid_f(x);
+  if (act == FUSED_ACT_TANH) return cpu_tanh_f(x);
+  return x;
+}
+
+// acc{m,QUANT_BLOCK} = X{m,k} x W{QUANT_BLOCK,k}^T, two rows at a time
+QUANT_TARGETS
+static void qgemm_tile(int m, int k, const int16_t *X, const int8_t *W, int32_t *acc) {
+  const int8_t *w0 = W, *w1 = w0 + k, *w2 = w1 + k, *w3 = w2 + k;
+
+  for (int r = 0; r < m; r += 2) {
+    const int16_t *x0 = X + (size_t)r * k;
+    const int16_t *x1 = (r + 1 < m) ? x0 + k : x0;
+    int s00 = 0, s01 = 0, s02 = 0, s03 = 0, s10 = 0, s11 = 0, s12 = 0, s13 = 0;
+
+    for (int i = 0; i < k; i++) {
+      s00 += x0[i] * w0[i]; s01 += x0[i] * w1[i]; s02 += x0[i] * w2[i]; s03 += x0[i] * w3[i];
+      s10 += x1[i] * w0[i]; s11 += x1[i] * w1[i]; s12 += x1[i] * w2[i]; s13 += x1[i] * w3[i];
+    }
+
+    int32_t *a = acc + r * QUANT_BLOCK;
+    a[0] = s00; a[1] = s01; a[2] = s02; a[3] = s03;
+    if (r + 1 < m) { a[4] = s10; a[5] = s11; a[6] = s12; a[7] = s13; }
+  }
+}
+
+// out(r,c)=act(acc(r,c)*in_scale*wscale[c]+bias[c]), at out[r*rs+c*cs]
+static void qgemm(int m, const int16_t *X, QuantDescriptor *Q, Tensor *bias, int act, float *out, int rs, int cs) {
+  int tiles = (m + QUANT_ROWS - 1) / QUANT_ROWS;
+  int blocks = Q->npad / QUANT_BLOCK;
+
+  #pragma omp parallel for collapse(2)
+  for (int t = 0; t < tiles; t++)
+    for (int cb = 0; cb < blocks; cb++) {
+      int32_t acc[QUANT_ROWS * QUANT_BLOCK];
+      int r0 = t * QUANT_ROWS;
+      int rows = std::min(QUANT_ROWS, m - r0);
+
+      qgemm_tile(rows, Q->nin, X + (size_t)r0 * Q->nin, Q->W + (size_t)cb * QUANT_BLOCK * Q->nin, acc);
+
+      // requantize to float with the bias and the activation
+      for (int j = 0; j < QUANT_BLOCK; j++) {
+        int c = cb * QUANT_BLOCK + j;
+        if (c >= Q->nout) break;
+        float s = Q->in_scale * Q->wscale[c];
+        float b = (bias != nullptr) ? bias->ptr[c] : 0.0f;
+        for (int r = 0; r < rows; r++)
+          out[(size_t)(r0 + r) * rs + (size_t)c * cs] = quant_act(acc[r * QUANT_BLOCK + j] * s + b, act);
+      }
+    }
+}
+
+
+// With 16-bit weights the inputs stay in float: each block of QUANT_BLOCK
+// weight rows is decoded once per task and accumulated in fp32
+QUANT_TARGETS
+static void hgemm_tile(int m, int k, const float *X, const float *W, float *acc) {
+  const float *w0 = W, *w1 = w0 + k, *w2 = w1 + k, *w3 = w2 + k;
+
+  for (int r = 0; r < m; r += 2) {
+    const float *x0 = X + (size_t)r * k;
+    const float *x1 = (r + 1 < m) ? x0 + k : x0;
+    float s00 = 0, s01 = 0, s02 = 0, s03 = 0, s10 = 0, s11 = 0, s12 = 0, s13 = 0;
+
+    #pragma omp simd reduction(+:s00,s01,s02,s03,s10,s11,s12,s13)
+    for (int i = 0; i < k; i++) {
+      s00 += x0[i] * w0[i]; s01 += x0[i] * w1[i]; s02 += x0[i] * w2[i]; s03 += x0[i] * w3[i];
+      s10 += x1[i] * w0[i]; s11 += x1[i] * w1[i]; s12 += x1[i] * w2[i]; s13 += x1[i] * w3[i];
+    }
+
+    float *a = acc + r * QUANT_BLOCK;
+    a[0] = s00; a[1] = s01; a[2] = s02; a[3] = s03;
+    if (r + 1 < m) { a[4] = s10; a[5] = s11; a[6] = s12; a[7] = s13; }
+  }
+}
+
+QUANT_TARGETS
+static void decode_half(const uint16_t *H, float *W, int n, int dtype) {
+  if (dtype == DTYPE_BFLOAT16) {
+    #pragma omp simd
+    for (int i = 0; i < n; i++) W[i] = bf16_to_float(H[i]);
+  }
+  else {
+    #pragma omp simd
+    for (int i = 0; i < n; i++) W[i] = fp16_to_float(H[i]);
+  }
+}
+
+// out(r,c)=act(X(r,:)·H(c,:)+bias[c]), at out[r*rs+c*cs]
+static void hgemm(int m, const float *X, QuantDescriptor *Q, Tensor *bias, int act, float *out, int rs, int cs) {
+  int tiles = (m + QUANT_ROWS - 1) / QUANT_ROWS;
+  int blocks = Q->npad / QUANT_BLOCK;
+  int k = Q->nin;
+
+  #pragma omp parallel
+  {
+    vector<float> W((size_t)QUANT_BLOCK * k);
+    int wcb = -1;  // block decoded in W (tasks of a thread are consecutive)
+
+    #pragma omp for collapse(2)
+    for (int cb = 0; cb < blocks; cb++)
+      for (int t = 0; t < tiles; t++) {
+        float acc[QUANT_ROWS * QUANT_BLOCK];
+        int r0 = t * QUANT_ROWS;
+        int rows = std::min(QUANT_ROWS, m - r0);
+
+        if (cb != wcb) {
+          decode_half(Q->H + (size_t)cb * QUANT_BLOCK * k, W.data(), QUANT_BLOCK * k, Q->dtype);
+          wcb = cb;
+        }
+        hgemm_tile(rows, k, X + (size_t)r0 * k, W.data(), acc);
+
+        for (int j = 0; j < QUANT_BLOCK; j++) {
+          int c = cb * QUANT_BLOCK + j;
+          if (c >= Q->nout) break;
+          float b = (bias != nullptr) ? bias->ptr[c] : 0.0f;
+          for (int r = 0; r < rows; r++)
+            out[(size_t)(r0 + r) * rs + (size_t)c * cs] = quant_act(acc[r * QUANT_BLOCK + j] + b, act);
+        }
+      }
+  }
+}
+
+
+void cpu_qdense(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *C, int act) {
+  _profile(_CPU_QDENSE, 0);
+  int m = A->shape[0];
+  if (Q->dtype != DTYPE_INT8) {
+    hgemm(m, A->ptr, Q, bias, act, C->ptr, Q->nout, 1);
+    _profile(_CPU_QDENSE, 1);
+    return;
+  }
+
+  int k = Q->nin;
+  float inv = 1.0f / Q->in_scale;
+  int lo = -Q->in_zero, hi = 255 - Q->in_zero;
+
+  vector<int16_t> X((size_t)m * k);
+  #pragma omp parallel for
+  for (int i = 0; i < m * k; i++)
+    X[i] = quant_in(A->ptr[i], inv, lo, hi);
+
+  qgemm(m, X.data(), Q, bias, act, C->ptr, Q->nout, 1);
+  _profile(_CPU_QDENSE, 1);
+}
+
+
+// Lowered (im2col) rows of one image: row = output pixel, columns ordered
+// as the kernels {kz,kr,kc}
+template<typename T>
+static void lower_rows(ConvolDescriptor *D, const vector<int> &wy, const vector<int> &wx, const T *img, T *X) {
+  int orsize = D->r * D->c;
+  int irsize = D->ir * D->ic;
+  int k = D->kz * D->kr * D->kc;
+
+  #pragma omp parallel for
+  for (int j = 0; j < orsize; j++) {
+    int py = wy[j], px = wx[j];
+    T *x = X + (size_t)j * k;
+
+    for (int z = 0; z < D->kz; z++)
+      for (int ky = 0; ky < D->kr; ky++) {
+        int y = py + ky * D->dr;
+        for (int kx = 0; kx < D->kc; kx++, x++) {
+          int xx = px + kx * D->dc;
+          *x = ((y < 0) || (y >= D->ir) || (xx < 0) || (xx >= D->ic)) ? 0 : img[z * irsize + y * D->ic + xx];
+        }
+      }
+  }
+}
+
+// int8: the rows are built already quantized, 16-bit weights: float rows
+void cpu_qconv2D(ConvolDescriptor *D) {
+  _profile(_CPU_QCONV2D, 0);
+  QuantDescriptor *Q = D->qd;
+  int orsize = D->r * D->c;
+  int isize = D->iz * D->ir * D->ic;
+  int k = Q->nin;
+  Tensor *bias = D->use_bias ? D->bias : nullptr;
+
+  // Window corner of each output pixel
+  vector<int> wy(orsize), wx(orsize);
+  for (int j = 0; j < orsize; j++) {
+    wy[j] = -D->padrt + (j / D->c) * D->sr;
+    wx[j] = -D->padcl + (j % D->c) * D->sc;
+  }
+
+  if (Q->dtype != DTYPE_INT8) {
+    vector<float> X((size_t)orsize * k);
+    for (int b = 0; b < D->I->shape[0]; b++) {
+      lower_rows(D, wy, wx, D->I->ptr + (size_t)b * isize, X.data());
+      hgemm(orsize, X.data(), Q, bias, D->fused_act, D->O->ptr + (size_t)b * D->O->stride[0], 1, orsize);
+    }
+    _profile(_CPU_QCONV2D, 1);
+    return;
+  }
+
+  float inv = 1.0f / Q->in_scale;
+  int lo = -Q->in_zero, hi = 255 - Q->in_zero;
+  vector<int16_t> X((size_t)orsize * k);
+
+  // each input pixel is quantized once, then lowered
+  vector<int16_t> XI((size_t)isize);
+
+  for (int b = 0; b < D->I->shape[0]; b++) {
+    const float *ptrI = D->I->ptr + (size_t)b * isize;
+    int16_t *qi = XI.data();
+
+    #pragma omp parallel for
+    for (int i = 0; i < isize; i++)
+      qi[i] = quant_in(ptrI[i], inv, lo, hi);
+
+    lower_rows(D, wy, wx, (const int16_t *)qi, X.data());
+    qgemm(orsize, X.data(), Q, bias, D->fused_act, D->O->ptr + (size_t)b * D->O->stride[0], 1, orsize);
+  }
+  _profile(_CPU_QCONV2D, 1);
+}
@@ -25,8 +25,7 @@ LConv::LConv(Layer *parent, const vector<int> &ks, const vector<int> &st,
              const vector<int> &p, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(ks, st, p, mem), name, dev, mem) {}
 
 LConv::LConv(Layer *parent, int filters, const vector<int> &kernel_size, const vector<int> &strides, string padding,
-             int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(filters, kernel_size, strides, padding, use_bias, mem), name, dev, mem) {
-    // TODO: Implement (Fix initialization)
+             int groups, const vector<int> &dilation_rate, bool use_bias, string name, int dev, int mem) : LConv(parent, new ConvolDescriptor(filters, kernel_size, strides, padding, use_bias, mem, groups, dilation_rate), name, dev, mem) {
 };
 
 LConv::LConv(Layer *parent, ConvolDescriptor *D, string name, int dev, int mem) : LinLayer(name, dev, mem) {
@@ -129,7 +128,7 @@ void LConv::apply_accumulated_gradients() {
 
 Layer *LConv::share(int c, int bs, vector<Layer *> p) {
     // TODO: share ComvDescriptor
-    LConv *n = new LConv(p[0], cd->ksize, cd->stride, cd->pad,  name, dev,mem_level);
+    LConv *n = new LConv(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, cd->groups, {cd->dr, cd->dc}), name, dev, mem_level);
     n->orig = this;
     n->isshared=true;
     n->trainable = trainable;
@@ -143,7 +142,7 @@ Layer *LConv::share(int c, int bs, vector<Layer *> p) {
 
     n->cd->K = cd->K;
     n->cd->bias = cd->bias;
-    n->cd->matK = cd->matK;
+    new(&n->cd->matK) Eigen::Map<Eigen::MatrixXf>(cd->K->ptr, cd->kr * cd->kc * cd->kz, cd->nk);
 
     n->params.push_back(n->cd->K);
     n->params.push_back(n->cd->bias);
@@ -177,7 +176,7 @@ Layer *LConv::share(int c, int bs, vector<Layer *> p) {
 
 Layer *LConv::clone(int c, int bs, vector<Layer *> p, int todev) {
 
-    LConv *n = new LConv(p[0], cd->ksize, cd->stride, cd->pad,  name, todev, this->mem_level);
+    LConv *n = new LConv(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, this->mem_level, cd->groups, {cd->dr, cd->dc}), name, todev, this->mem_level);
     n->trainable = trainable;
 
     n->orig = this;
@@ -19,20 +19,173 @@ using namespace std;
 
 int LConvT::total_layers = 0;
 
+// Kernels of the convolution from the output to the input
+static vector<int> convt_kernels(Layer *parent, const vector<int> &kernel_size) {
+    if (kernel_size.size() != 2) msg("Kernels must have 2 dimensions", "LConvT::LConvT");
+    return {parent->output->shape[1], kernel_size[0], kernel_size[1]};
+}
+
+// Pads {top, bottom, left, right} of the output. With "same" the output is
+// input*stride, as ONNX SAME_UPPER (output_padding goes to the pads)
+static vector<int> convt_pads(const vector<int> &kernel_size, const vector<int> &output_padding,
+                              const string& padding, const vector<int> &dilation_rate, const vector<int> &strides) {
+    if ((kernel_size.size() != 2) || (output_padding.size() != 2) || (dilation_rate.size() != 2) || (strides.size() != 2))
+        msg("Kernels, output padding, dilation rates and strides must have 2 dimensions", "LConvT::LConvT");
+
+    if (padding=="valid" || padding=="none") return {0, 0, 0, 0};
+    if (padding!="same") msg("Incorrect padding type", "LConvT::LConvT");
+
+    vector<int> pads;
+    for(int i=0;i<2;i++) {
+        int pad = output_padding[i] + (kernel_size[i] - 1) * dilation_rate[i] + 1 - strides[i];
+        pad = std::max(pad, 0);
+        pads.push_back(pad/2);
+        pads.push_back(pad - pad/2);
+    }
+    return pads;
+}
+
 // ---- TRANSPOSED CONVOLUTION ----
 LConvT::LConvT(Layer *parent, int filters, const vector<int> &kernel_size,
     const vector<int> &output_padding, string padding, const vector<int> &dilation_rate,
-    const vector<int> &strides, bool use_bias, string name, int dev, int mem) : LConvT(parent, new ConvolDescriptor(filters, kernel_size, strides, padding,mem), name, dev, mem) {
-    // TODO: Implement (Fix initialization)
-};
+    const vector<int> &strides, bool use_bias, string name, int dev, int mem) :
+    LConvT(parent, new ConvolDescriptor(convt_kernels(parent, kernel_size), strides,
+                                        convt_pads(kernel_size, output_padding, padding, dilation_rate, strides),
+                                        mem, 1, dilation_rate),
+           filters, output_padding, use_bias, name, dev, mem) {}
+
+LConvT::LConvT(Layer *parent, ConvolDescriptor *D, int filters, const vector<int> &output_padding, bool use_bias,
+               string name, int dev, int mem) : LinLayer(name, dev, mem) {
+    if (parent->output->ndim != 4) msg("LConvT only works over 4D tensors", "LConvT::LConvT");
+    if (!parent->output->isCPU()) msg("LConvT is only implemented for CPU", "LConvT::LConvT");
+    if (output_padding.size() != 2) msg("Output padding must have 2 dimensions", "LConvT::LConvT");
 
-LConvT::LConvT(Layer *parent, ConvolDescriptor *cd, string name, int dev, int mem) : LinLayer(name, dev, mem) {
-    // TODO: Implement (Fix initialization)
     if(name.empty()) this->name = "convt" + to_string(++total_layers);
 
-    this->cd = cd;
+    input = parent->output;
+    cd = D;
+    this->output_padding = output_padding;
+    this->use_bias = use_bias;
+
+    // Output size, as the input of the convolution cd gives back the input
+    vector<int> size;
+    for(int i=0;i<2;i++) {
+        int ek = (cd->ksize[i+1] - 1) * ((i==0) ? cd->dr : cd->dc) + 1;
+        if ((output_padding[i] < 0) || (output_padding[i] >= cd->stride[i]))
+            msg("Output padding must be lower than the stride", "LConvT::LConvT");
+        size.push_back((input->shape[i+2] - 1) * cd->stride[i] + ek - cd->pad[2*i] - cd->pad[2*i+1] + output_padding[i]);
+    }
+    if ((size[0] <= 0) || (size[1] <= 0)) msg("Invalid output shape", "LConvT::LConvT");
+
+    output = new Tensor(vector<int>{input->shape[0], filters, size[0], size[1]}, dev);
+    cd->build(output);
+    if ((cd->nk != input->shape[1]) || (cd->r != input->shape[2]) || (cd->c != input->shape[3]))
+        msg("Invalid output shape", "LConvT::LConvT");
+
+    // cd->O is only a buffer for the delta, cd has no bias: the one of the
+    // layer is on the output channels
+    cd->use_bias = false;
+    delete cd->bias;
+    delete cd->gbias;
+    cd->bias = new Tensor(vector<int>{filters}, dev);
+    cd->gbias = new Tensor(vector<int>{filters}, dev);
+
+    params.push_back(cd->K);
+    params.push_back(cd->bias);
+
+    gradients.push_back(cd->gK);
+    gradients.push_back(cd->gbias);
+
+    parent->addchild(this);
+    addparent(parent);
 }
 
 LConvT::~LConvT(){
+    delete cd->O;
     delete cd;  // Just in case
-}
\ No newline at end of file
+}
+
+// virtual
+void LConvT::resize(int batch){
+    Layer::resize(batch);
+    cd->resize(batch);
+}
+
+void LConvT::forward() {
+    cd->I = output;
+    cd->D = input;
+    cd->ID = output;
+    tensorNN::Conv2DT(cd, use_bias ? cd->bias : nullptr);
+}
+
+void LConvT::backward() {
+    cd->I = delta;
+    cd->D = input;
+
+    // backprop delta (first, so the gradient finds delta lowered with mem_level 0)
+    if (parent.size()) {
+        tensorNN::Conv2DT_back(cd, parent[0]->delta);
+    }
+
+    //get gradients with provided delta
+    if (trainable) { tensorNN::Conv2DT_grad(cd, use_bias ? cd->gbias : nullptr); }
+
+    // Regularizer
+    if (trainable) if(reg!= nullptr) {reg->apply(cd->K);}
+}
+
+Layer *LConvT::share(int c, int bs, vector<Layer *> p) {
+    LConvT *n = new LConvT(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, 1, {cd->dr, cd->dc}),
+                           cd->iz, output_padding, use_bias, "share_"+to_string(c)+this->name, dev, mem_level);
+    n->orig = this;
+    n->isshared=true;
+    n->trainable = trainable;
+
+    //share params and gradients
+    for (int i = 0; i < n->params.size(); i++) delete n->params[i];
+    for (int i = 0; i < n->gradients.size(); i++) delete n->gradients[i];
+    n->params.clear();
+    n->gradients.clear();
+
+    n->cd->K = cd->K;
+    n->cd->bias = cd->bias;
+    n->cd->gK = cd->gK;
+    n->cd->gbias = cd->gbias;
+
+    n->params.push_back(n->cd->K);
+    n->params.push_back(n->cd->bias);
+    n->gradients.push_back(n->cd->gK);
+    n->gradients.push_back(n->cd->gbias);
+
+    n->reg=reg;
+    n->init=init;
+
+    return n;
+}
+
+Layer *LConvT::clone(int c, int bs, vector<Layer *> p, int todev) {
+    LConvT *n = new LConvT(p[0], new ConvolDescriptor(cd->ksize, cd->stride, cd->pad, mem_level, 1, {cd->dr, cd->dc}),
+                           cd->iz, output_padding, use_bias, name, todev, mem_level);
+    n->orig = this;
+    n->trainable = trainable;
+
+    n->reg=reg;
+    n->init=init;
+
+    return n;
+}
+
+
+void LConvT::update_weights(Tensor* w, Tensor* bias) {
+    Tensor::copy( w, cd->K );
+    if ( bias != nullptr ) Tensor::copy( bias, cd->bias );
+}
+
+string LConvT::plot(int c) {
+    string s;
+
+    if (c) s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=gray,shape=box]";
+    else s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=White,shape=box]";
+
+    return s;
+}
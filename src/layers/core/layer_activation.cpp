@@ -143,7 +143,7 @@ void LActivation::backward(){
 }
 
 
-void LActivation::save(std::ofstream &ofs, string format){
+void LActivation::save(std::ofstream &ofs, string format, const string& dtype){
     // Save act
     // Save param for "lrelu"
 }
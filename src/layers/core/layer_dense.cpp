@@ -40,6 +40,8 @@ LDense::LDense(Layer *parent, int ndim, bool use_bias, string name, int dev, int
     if (use_bias) gradients.push_back(gbias);
 
     distributed_training = false;
+    fused_act = FUSED_ACT_NONE;
+    qd = nullptr;
     acc_gW = nullptr;
     acc_gbias = nullptr;
 
@@ -49,11 +51,17 @@ LDense::LDense(Layer *parent, int ndim, bool use_bias, string name, int dev, int
 
 LDense::~LDense(){
     // input, output, delta, params[], and gradients[], acc_gradients[] => deleted in ~Layer()
+    delete qd;
 }
 
 void LDense::forward() {
+    if (qd != nullptr) {
+        tensorNN::QDense(input, qd, use_bias ? bias : nullptr, output, fused_act);
+        return;
+    }
     Tensor::mult2D(input, 0, W, 0, output, 0);
-    if (use_bias) Tensor::sum2D_rowwise(output, bias, output);
+    if (fused_act != FUSED_ACT_NONE) tensorNN::BiasActivation(output, use_bias ? bias : nullptr, fused_act);
+    else if (use_bias) Tensor::sum2D_rowwise(output, bias, output);
 }
 
 void LDense::backward() {
@@ -11,8 +11,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <algorithm>
 
 #include "eddl/layers/core/layer_core.h"
+#include "eddl/tensor/nn/tensor_nn.h"
 
 using namespace std;
 
@@ -60,6 +62,7 @@ LEmbedding::LEmbedding(Layer *parent, int vocsize, int length, int dim, bool mas
 
     gE=new Tensor({vocsize,dim},dev);
     gradients.push_back(gE);
+    gE_clean=false;
 
 
     parent->addchild(this);
@@ -68,8 +71,7 @@ LEmbedding::LEmbedding(Layer *parent, int vocsize, int length, int dim, bool mas
 }
 
 LEmbedding::~LEmbedding(){
-    delete E;
-    delete gE;
+    // E and gE are deleted with the params and gradients (unless shared)
 }
 
 void LEmbedding::forward()
@@ -84,8 +86,11 @@ void LEmbedding::forward()
 
   sind.clear();
 
-  Tensor *inputc=input->clone();
-  inputc->toCPU();
+  Tensor *inputc=input;
+  if (!input->isCPU()) {
+    inputc=input->clone();
+    inputc->toCPU();
+  }
 
   for(int i=0;i<b*length;i++) {
       int val=(int)inputc->ptr[i*inputc->stride[0]];
@@ -98,7 +103,7 @@ void LEmbedding::forward()
     sind.push_back(val);
   }
 
-  delete inputc;
+  if (inputc!=input) delete inputc;
 
   output->reshape_({b*length,dim});
 
@@ -120,6 +125,17 @@ void LEmbedding::backward()
 
      Tensor::deselect(delta,gE, sind, 0,sind.size(),1, mask_zeros); //1=inc
 
+     if (gE->isCPU()) {
+       // shared copies (unrolled nets) keep the rows in the original layer
+       LEmbedding *o=(isshared) ? (LEmbedding *)orig : this;
+       o->touched.insert(o->touched.end(),sind.begin(),sind.end());
+       sort(o->touched.begin(),o->touched.end());
+       o->touched.erase(unique(o->touched.begin(),o->touched.end()),o->touched.end());
+       // the padding row is kept at zero
+       if ((mask_zeros)&&(!o->touched.empty())&&(o->touched[0]==0))
+         o->touched.erase(o->touched.begin());
+     }
+
      delta->reshape_({b,length*dim});
 
      if(reg!= nullptr) {reg->apply(E);}
@@ -128,6 +144,28 @@ void LEmbedding::backward()
 
 
 
+// Only the rows written by backward have to be cleared
+void LEmbedding::zeroGrads()
+{
+  LEmbedding *o=(isshared) ? (LEmbedding *)orig : this;
+
+  if ((gE->isCPU())&&(o->gE_clean))
+    tensorNN::zero_rows(gE,o->touched);
+  else {
+    gE->fill_(0.0);
+    o->gE_clean=gE->isCPU();
+  }
+  o->touched.clear();
+}
+
+vector<int> *LEmbedding::sparse_rows(int i)
+{
+  LEmbedding *o=(isshared) ? (LEmbedding *)orig : this;
+
+  if ((i==0)&&(gE->isCPU())&&(o->gE_clean)) return &o->touched;
+  return nullptr;
+}
+
 
 Layer *LEmbedding::share(int c, int bs, vector<Layer *> p) {
     LEmbedding *n = new LEmbedding(p[0],vocsize, length, dim, mask_zeros, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
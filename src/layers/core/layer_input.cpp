@@ -53,6 +53,17 @@ void LInput::free_delta(){
   delta->fill_(0.0);
 }
 
+void LInput::resize(int batch){
+  Layer::resize(batch);
+
+  // The delta is kept between backwards (see free_delta), so it is booked
+  // again with the new batch
+  if ((delta!=nullptr) && (delta->shape[0]!=batch)) {
+    delete delta;
+    delta=nullptr;
+  }
+}
+
 void LInput::forward() {
   if (parent.size()) {
     Tensor::copy(parent[0]->output,output);
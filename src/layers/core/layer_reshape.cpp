@@ -70,8 +70,9 @@ LReshape::LReshape(Layer *parent, vector<int> shape, string name, int dev, int m
 
     ///////
 
-    // sharing the pointers to data
+    // sharing the pointers to data (freed by the parent)
     output = new Tensor(ls, parent->output);
+    output->isshared = true;
 
     parent->addchild(this);
     addparent(parent);
@@ -101,6 +102,7 @@ void LReshape::mem_delta() {
 
         // Problem: Delta is always created, regardless of the low_mem
         delta = new Tensor(ls, parent[0]->delta);
+        delta->isshared = true;
 
         if(this->verbosity_level >= 2){
             std::cout << "Booked delta for: " + this->name << std::endl;
@@ -0,0 +1,81 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include "eddl/layers/da/layer_da.h"
+
+
+using namespace std;
+
+int LAffineRandom::total_layers = 0;
+
+LAffineRandom::LAffineRandom(Layer *parent, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, bool bilinear, WrappingMode da_mode, float cval, string name, int dev, int mem) : LDataAugmentation(parent, name, dev, mem) {
+    if(name.empty()) this->name = "affine_random" + to_string(++total_layers);
+
+    output = new Tensor(input->shape, dev);
+
+    // Params
+    this->rotation = rotation;
+    this->scale = scale;
+    this->shift_x = shift_x;
+    this->shift_y = shift_y;
+    this->flip_axis = flip_axis;
+    this->crop_scale = crop_scale;
+    this->cutout_x = cutout_x;
+    this->cutout_y = cutout_y;
+    this->bilinear = bilinear;
+    this->da_mode = da_mode;
+    this->cval = cval;
+
+    parent->addchild(this);
+    addparent(parent);
+
+}
+
+
+void LAffineRandom::forward() {
+    if (mode == TRMODE) {
+        Tensor::affine_random(this->input, this->output, this->rotation, this->scale, this->shift_x, this->shift_y, this->flip_axis, this->crop_scale, this->cutout_x, this->cutout_y, this->bilinear, this->da_mode, this->cval);
+    } else {
+        Tensor::copy(input, output);
+    }
+}
+
+void LAffineRandom::backward() {
+
+}
+
+
+Layer *LAffineRandom::share(int c, int bs, vector<Layer *> p) {
+    auto *n = new LAffineRandom(p[0], this->rotation, this->scale, this->shift_x, this->shift_y, this->flip_axis, this->crop_scale, this->cutout_x, this->cutout_y, this->bilinear, this->da_mode, this->cval, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
+    n->orig = this;
+
+    return n;
+}
+
+Layer *LAffineRandom::clone(int c, int bs, vector<Layer *> p, int todev) {
+    auto *n = new LAffineRandom(p[0], this->rotation, this->scale, this->shift_x, this->shift_y, this->flip_axis, this->crop_scale, this->cutout_x, this->cutout_y, this->bilinear, this->da_mode, this->cval, name, todev, this->mem_level);
+    n->orig = this;
+
+    return n;
+}
+
+
+string LAffineRandom::plot(int c) {
+    string s;
+
+    if (c) s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=bisque4,shape=box]";
+    else s = name + " [label=" + "\"" + name + "\",style=filled,fontsize=12,fillcolor=White,shape=box]";
+
+    return s;
+}
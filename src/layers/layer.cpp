@@ -40,6 +40,7 @@ Layer::Layer(string name, int dev, int mem) {
 
     orig=nullptr;
     net=nullptr;
+    params_version=0;
 
     reg = nullptr;
     init=new IGlorotNormal(1234);
@@ -84,12 +85,21 @@ void Layer::initialize() {
     for (int i = 0; i != params.size(); i++) {
         init->apply(params[i]);
     }
+    params_changed();
 }
 
 void Layer::clamp(float min, float max){
     for (int i = 0; i != params.size(); i++) {
         params[i]->clamp_(min,max);
     }
+    params_changed();
+}
+
+// Called after the values of params change, so layers can refresh what they
+// derive from them. Shared layers use the params of their orig
+void Layer::params_changed(){
+    params_version++;
+    if (orig!=nullptr) orig->params_changed();
 }
 
 void Layer::set_detach(){
@@ -188,9 +198,9 @@ vector<int> Layer::getShape(){
     return output->getShape();
 }
 
-void Layer::save(std::ofstream &ofs, string format){
+void Layer::save(std::ofstream &ofs, string format, const string& dtype){
     for (int i = 0; i != params.size(); i++){
-        params[i]->savefs(ofs, format);
+        params[i]->savefs(ofs, format, dtype);
     }
 }
 
@@ -200,6 +210,7 @@ void Layer::load(std::ifstream &ifs, string format){
         Tensor::copy(t,params[i]);
         delete t;
     }
+    params_changed();
 }
 
 void Layer::info() {
@@ -255,6 +266,7 @@ void Layer::copy(Layer *l2){
     for(int i=0;i<params.size();i++){
         Tensor::copy(params[i],l2->params[i]);
     }
+    l2->params_changed();
 }
 
 ////////////////////////////////////
@@ -73,7 +73,84 @@ LConcat::LConcat(vector<Layer *> parent, unsigned int axis, string name, int dev
 }
 
 
+// The outputs of the parents become slices of the output: parent i starts
+// at the offset of its channels, with the batch stride of the output. Any
+// parent can write there when all the dimensions before axis are 1 (e.g.
+// batch 1 over the channels); with a larger batch only the ones that write
+// strided outputs (see Net::inplace_concat), the rest are copied. Called after
+// every resize. Only the data is moved, the tensors may be cached by other
+// layers (e.g. LConv)
+void LConcat::alias_parents() {
+    int lead = 1;
+    for (int d = 0; d < this->axis; d++) lead *= output->shape[d];
+
+    sliced.assign(parent.size(), false);
+    aliased = inplace;
+    for (int i = 0; i < parent.size(); i++) {
+        sliced[i] = inplace && ((lead == 1) || ((axis == 1) && strided[i]));
+        aliased = aliased && sliced[i];
+    }
+
+    // Own outputs (the resize usually gave them back already), and the
+    // deltas are taken again in mem_delta_parent
+    for (int i = 0; i < parent.size(); i++) {
+        Layer *p = parent[i];
+        if ((!sliced[i]) && (p->output->isshared)) {
+            p->output->deleteData();
+            p->output->updateData(nullptr);
+            p->output->updateStrides();
+        }
+        if ((p->delta != nullptr) && (p->delta->isshared)) {
+            p->delta->deleteData();
+            p->delta->updateData(nullptr);
+            p->delta->updateStrides();
+        }
+    }
+
+    float *ptr = output->ptr;
+    for (int i = 0; i < parent.size(); i++) {
+        Layer *p = parent[i];
+        if ((sliced[i]) && (p->output->ptr != ptr)) {
+            p->output->deleteData();
+            p->output->updateData(ptr);
+            p->output->isshared = true;
+        }
+        if ((sliced[i]) && (lead > 1)) p->output->stride[0] = output->stride[0];
+        ptr += p->output->stride[axis] * p->output->shape[axis];
+    }
+}
+
+void LConcat::mem_delta_parent() {
+    if ((!inplace) || (mem_level)) { Layer::mem_delta_parent(); return; }
+
+    // With mem_level 0 the deltas of the sliced parents are slices of delta
+    // from now on. The part a parent already got from its other children is moved
+    float *ptr = delta->ptr;
+    for (int i = 0; i < parent.size(); i++) {
+        Layer *p = parent[i];
+        p->mem_delta();
+        if ((sliced[i]) && (p->delta->ptr != ptr)) {
+            int n = p->delta->shape[0];
+            int bsize = p->delta->size / n;
+            for (int b = 0; b < n; b++) {
+                float *d = ptr + (size_t)b * p->output->stride[0];
+                const float *s = p->delta->ptr + (size_t)b * bsize;
+                for (int k = 0; k < bsize; k++) d[k] += s[k];
+            }
+
+            p->delta->deleteData();
+            p->delta->updateData(ptr);
+            p->delta->stride[0] = p->output->stride[0];
+            p->delta->isshared = true;
+        }
+        ptr += p->output->stride[axis] * p->output->shape[axis];
+    }
+}
+
 void LConcat::forward() {
+    // The parents wrote there (the sliced ones are skipped by concat)
+    if (aliased) return;
+
     // Get output tensors
     vector<Tensor*> outputs;
     for (auto & p : this->parent) { outputs.push_back(p->output); }
@@ -84,6 +161,10 @@ void LConcat::forward() {
 
 
 void LConcat::backward() {
+    // The deltas of the parents are slices of delta (the sliced ones are
+    // skipped by concat_back)
+    if ((aliased) && (!mem_level)) return;
+
     // Get delta tensors
     vector<Tensor*> deltas;
     for (int i=0; i<this->parent.size(); i++) {
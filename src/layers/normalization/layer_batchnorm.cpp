@@ -103,10 +103,18 @@ void LBatchNorm::resize(int batch){
 // Batchnorm works over 2D Tensors
 // Essentialy 4D Tensors are reshaped as 2D and
 // Permute 4D tensors and set N,M values.
+// On CPU the fused kernels work directly over NCHW.
 void LBatchNorm::forward() {
     // Input = Output = opa = {Batch,Channels,H,W} OR {Batch,Dim}
     // bn_mean = bn_var = mean = variance = bn_g = bn_b = {Channels} or {Dim}
 
+    if (input->isCPU()) {
+        tensorNN::BatchNormForward(input, output, opa, mean, variance,
+                                   affine ? bn_g : nullptr, affine ? bn_b : nullptr,
+                                   bn_mean, bn_var, momentum, epsilon, mode==TRMODE);
+        return;
+    }
+
     int M,N;
     int b,z,r,c,d;
     Tensor *in;
@@ -161,6 +169,13 @@ void LBatchNorm::backward(){
 
     Tensor *dp;
 
+    if (input->isCPU()) {
+        tensorNN::BatchNormBackward(delta, opa, parent[0]->delta,
+                                    affine ? gbn_g : nullptr, affine ? gbn_b : nullptr,
+                                    affine ? bn_g : nullptr, bn_var);
+        return;
+    }
+
     if (input->ndim==2) {
         N=b=input->shape[0];
         M=d=input->shape[1];
@@ -29,17 +29,21 @@ LMaxPool::LMaxPool(Layer *parent, const vector<int> &pool_size, const vector<int
 LMaxPool::LMaxPool(Layer *parent, PoolDescriptor *D, const string& name, int dev, int mem) : LPool(parent, D, name, dev, mem) {
     if(name.empty()) this->name = "maxpool" + to_string(++total_layers);
 
-    // Params
-    D->indX = new Tensor(D->O->shape, dev);  // Is this needed here?
-    D->indY = new Tensor(D->O->shape, dev);
+    // Params (the CPU kernels keep their own int32 indexes in the descriptor)
+    if (dev != DEV_CPU) {
+        D->indX = new Tensor(D->O->shape, dev);
+        D->indY = new Tensor(D->O->shape, dev);
+    }
 }
 
 
 void LMaxPool::resize(int batch){
   LPool::resize(batch);
 
-  delete pd->indX; pd->indX = new Tensor(pd->O->shape, dev);
-  delete pd->indY; pd->indY = new Tensor(pd->O->shape, dev);
+  if (dev != DEV_CPU) {
+      delete pd->indX; pd->indX = new Tensor(pd->O->shape, dev);
+      delete pd->indY; pd->indY = new Tensor(pd->O->shape, dev);
+  }
 }
 
 void LMaxPool::forward() {
@@ -98,6 +98,17 @@ LLSTM::LLSTM(vector<Layer *> parent, int units, bool mask_zeros, bool bidirectio
     gcnbias = new Tensor(vector<int>{units}, dev);
     gradients.push_back(gcnbias);
 
+    // Workspaces of the fused kernels (CPU), sized here and at resize
+    gates = nullptr;
+    if (dev == DEV_CPU) {
+        gates = new Tensor(vector<int>{input->shape[0], 4*units}, dev);
+        sh = new Tensor(vector<int>{input->shape[0], units}, dev);
+    }
+
+    base = this;
+    Wx_packed = Wh_packed = bias_packed = nullptr;
+    packed_version = 0;
+
     for (int i = 0; i < parent.size(); ++i) {
         parent[i]->addchild(this);
         addparent(parent[i]);
@@ -110,6 +121,13 @@ LLSTM::LLSTM(vector<Layer *> parent, int units, bool mask_zeros, bool bidirectio
 LLSTM::~LLSTM(){
 //    delete cps;
 //    delete state_c;
+    if (gates != nullptr) {
+        delete gates;
+        delete sh;
+    }
+    delete Wx_packed;
+    delete Wh_packed;
+    delete bias_packed;
 }
 
 // RESIZE , MEM_DELTA states
@@ -154,6 +172,10 @@ void LLSTM::resize(int batch){
         output->resize(batch);
         state_c->resize(batch);
     }
+    if (gates!=nullptr) {
+        gates->resize(batch);
+        sh->resize(batch);
+    }
 
 }
 
@@ -192,8 +214,49 @@ Tensor *replicate_tensor(Tensor *input,int d)
 }
 
 
+// Changes when the params are updated (params_changed) or overwritten with
+// Tensor::copy (load, ONNX import, copyParam, the params of the snets...).
+// Both counters only grow, so the sum does too
+unsigned long LLSTM::weights_version() {
+    unsigned long v = params_version;
+    for (int i = 0; i < params.size(); i++) v += params[i]->version;
+    return v;
+}
+
+// [Wix | Wfx | Wox | Wcx], [Wih | Wfh | Woh | Wch] and biases, so each step
+// does one GEMM for the input and one for the previous state
+void LLSTM::pack_weights() {
+    if (Wx_packed == nullptr) {
+        Wx_packed = new Tensor(vector<int>{Wix->shape[0], 4*units}, dev);
+        Wh_packed = new Tensor(vector<int>{units, 4*units}, dev);
+        bias_packed = new Tensor(vector<int>{1, 4*units}, dev);
+    }
+    tensorNN::lstm_pack({Wix, Wfx, Wox, Wcx}, Wx_packed);
+    tensorNN::lstm_pack({Wih, Wfh, Woh, Wch}, Wh_packed);
+    tensorNN::lstm_pack({inbias, fnbias, onbias, cnbias}, bias_packed);
+
+    packed_version = weights_version();
+}
+
 // virtual
 void LLSTM::forward() {
+    if (gates != nullptr) {
+        if ((base->Wx_packed == nullptr) || (base->packed_version != base->weights_version())) base->pack_weights();
+
+        Tensor *prev_h = nullptr, *prev_c = nullptr;
+        if (parent.size()>1) {
+            prev_h = parent[1]->states[0];
+            prev_c = parent[1]->states[1];
+        }
+
+        Tensor::mult2D(parent[0]->output, 0, base->Wx_packed, 0, gates, 0);
+        if (parent.size()>1) {
+            Tensor::mult2D(prev_h, 0, base->Wh_packed, 0, gates, 1);
+        }
+        tensorNN::lstm_cell(gates, base->bias_packed, mask_zeros ? parent[0]->output : nullptr, prev_h, prev_c, state_h, state_c, sh);
+        return;
+    }
+
     if (mask_zeros) {
         mask=new Tensor({input->shape[0],1},dev);
         reduced_abs_sum(input,mask);
@@ -303,6 +366,30 @@ void LLSTM::forward() {
 void LLSTM::backward() {
     //delta_h=delta;
     //delta_c
+    if (gates != nullptr) {
+        Tensor *prev_c = nullptr, *prev_dh = nullptr, *prev_dc = nullptr;
+        if (parent.size()>1) {
+            prev_c = parent[1]->states[1];
+            prev_dh = parent[1]->delta_states[0];
+            prev_dc = parent[1]->delta_states[1];
+        }
+
+        // gates --> deltas of the gates
+        tensorNN::d_lstm_cell(gates, sh, mask_zeros ? parent[0]->output : nullptr, prev_c, delta_h, delta_c, prev_dh, prev_dc);
+
+        if (trainable) {
+            tensorNN::lstm_grad(parent[0]->output, gates, {gWix, gWfx, gWox, gWcx});
+            if (parent.size()>1)
+                tensorNN::lstm_grad(parent[1]->states[0], gates, {gWih, gWfh, gWoh, gWch});
+            tensorNN::lstm_grad(nullptr, gates, {ginbias, gfnbias, gonbias, gcnbias});
+        }
+
+        Tensor::mult2D(gates, 0, base->Wx_packed, 1, parent[0]->delta, 1);
+        if (parent.size()>1)
+            Tensor::mult2D(gates, 0, base->Wh_packed, 1, prev_dh, 1);
+        return;
+    }
+
     if (mask_zeros) {
         if (parent.size()>1) {
             Tensor::logical_not(mask,mask);
@@ -441,6 +528,7 @@ Layer *LLSTM::share(int c, int bs, vector<Layer *> p) {
     LLSTM *n = new LLSTM(p, units, mask_zeros, bidirectional, "share_"+to_string(c)+this->name, this->dev, this->mem_level);
     n->orig = this;
     n->isshared=true;
+    n->base = base;
 
     //share params
     for (int i = 0; i < n->params.size(); i++) delete n->params[i];
@@ -24,4 +24,10 @@ void Loss::delta(Tensor *T, Tensor *Y, Tensor *D) {}
 
 float Loss::value(Tensor *T, Tensor *Y) {return 0;}
 
+float Loss::value_delta(Tensor *T, Tensor *Y, Tensor *D) {
+    float f = value(T, Y);
+    delta(T, Y, D);
+    return f;
+}
+
 Loss* Loss::clone() {return this;}
@@ -38,6 +38,12 @@ float LSoftCrossEntropy::value(Tensor *T, Tensor *Y) {
 
     return f;
 }
+float LSoftCrossEntropy::value_delta(Tensor *T, Tensor *Y, Tensor *D) {
+    // Fused: one pass over T and Y
+    int size=T->size/T->shape[0];  // batch is divided in print_loss
+    return tensorNN::soft_cent(T, Y, D)/size;
+}
+
 Loss* LSoftCrossEntropy::clone()
 {
   return new LSoftCrossEntropy();
@@ -0,0 +1,71 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+
+#include "eddl/net/dataset.h"
+#include "eddl/utils.h"
+
+using namespace std;
+
+
+Dataset::Dataset(const vector<string> &filenames, bool sequential) {
+    if (filenames.empty()) msg("No files", "Dataset");
+
+    owner = true;
+    for (auto &f : filenames) shards.push_back(Tensor::load_mapped(f, sequential));
+    set_shape();
+}
+
+Dataset::Dataset(Tensor *t) {
+    if (!t->isCPU()) msg("Data must be on CPU", "Dataset");
+
+    owner = false;
+    shards.push_back(t);
+    set_shape();
+}
+
+Dataset::~Dataset() {
+    if (owner)
+        for (auto t : shards) delete t;
+}
+
+void Dataset::set_shape() {
+    shape = shards[0]->shape;
+    num_samples = 0;
+    for (auto t : shards) {
+        if (!std::equal(t->shape.begin() + 1, t->shape.end(), shape.begin() + 1) || t->ndim != shape.size())
+            msg("The shards must have the same sample shape", "Dataset");
+        offsets.push_back(num_samples);
+        num_samples += t->shape[0];
+    }
+    shape[0] = num_samples;
+}
+
+void Dataset::select(const vector<int> &sind, Tensor *B) {
+    int n = sind.size();
+    int row = B->size / n;
+    if (B->shape[0] != n || row != shards[0]->size / shards[0]->shape[0]) msg("Incompatible dimensions", "Dataset::select");
+    for (auto i : sind) if (i < 0 || i >= num_samples) msg("Index out of range", "Dataset::select");
+
+    // Rows are read in file order (page cache and read-ahead friendly)
+    vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&sind](int a, int b) { return sind[a] < sind[b]; });
+
+    #pragma omp parallel for
+    for (int i = 0; i < n; i++) {
+        int k = order[i];
+        int s = std::upper_bound(offsets.begin(), offsets.end(), sind[k]) - offsets.begin() - 1;
+        memcpy(B->ptr + k * row, shards[s]->ptr + (size_t)(sind[k] - offsets[s]) * row, row * sizeof(float));
+    }
+}
@@ -17,6 +17,7 @@
 #include <chrono>
 #include <thread>
 #include "eddl/net/net.h"
+#include "eddl/descriptors/descriptors.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
@@ -67,14 +68,17 @@ int isInorig(Layer *l, vlayer vl, int &ind) {
 Net::Net() {
     batch_size=1;
     optimizer = nullptr;
+    cs = nullptr;
     name="model";
     tr_batches=0;
     flog_tr=nullptr;
     flog_ts=nullptr;
     rnet=nullptr;
+    pool=nullptr;
     isbuild=false;
     isdecoder=false;
     isencoder=false;
+    isinference=false;
     isrecurrent=false;
     decsize=1;
 }
@@ -194,9 +198,13 @@ Net::~Net()
         metrics[i] = nullptr;
     }
 
+    stop_snets();
+
     delete cs;
     delete optimizer;
     delete rnet;
+    delete conv_ws;
+    if (arena!=nullptr) free_fmem(arena);
 
 
 //    vlayer lin;
@@ -346,7 +354,10 @@ void Net::setlogfile(string fname)
 }
 
 
-void Net::save(const string& filename, string format){
+void Net::save(const string& filename, string format, const string& dtype){
+    // Folded BatchNorm, fused activations and quantized weights are not saved
+    if (isinference) msg("Net optimized for inference, save it before optimize_inference, quantize or plan_memory", "Net.save");
+
     // Open file stream
     std::ofstream ofs(filename, std::ios::out | std::ios::binary);
 
@@ -356,7 +367,7 @@ void Net::save(const string& filename, string format){
 
 
     for (int i = 0; i != layers.size(); i++){
-        layers[i]->save(ofs, format);
+        layers[i]->save(ofs, format, dtype);
     }
 
     // Close file stream
@@ -16,7 +16,9 @@
 #include <chrono>
 #include <thread>
 #include <stdexcept>
+#include <exception>
 #include "eddl/net/net.h"
+#include "eddl/net/prefetcher.h"
 #include <pthread.h>
 #include "eddl/utils.h"
 #include "eddl/random.h"
@@ -34,8 +36,11 @@ using namespace std::chrono;
 
 /////////////////////////////////////////
 //// THREADS
+struct SnetPool;
+
 struct tdata {
   Net *net;
+  SnetPool *pool;
 };
 
 
@@ -47,9 +52,7 @@ void *train_batch_t(void *t) {
   net->do_reset();
   net->do_reset_grads();
   net->do_forward();
-  net->do_compute_loss();
-
-  net->do_delta();
+  net->do_compute_loss_delta();
   net->do_backward();
   net->do_applygrads();
 
@@ -148,34 +151,143 @@ void *update_t(void *t) {
 
 
 
+/////////////////////////////////////////
+//// PERSISTENT SNETS WORKERS
+// One long-lived thread per snet. run_snets publishes the function to
+// execute and bumps the generation counter; workers run it on their
+// own snet and the last one to finish wakes up the caller (barrier).
+struct SnetPool {
+  pthread_mutex_t mtx;
+  pthread_cond_t start_cv;
+  pthread_cond_t done_cv;
+  vector<pthread_t> thr;
+  vector<tdata> td;
+  void *(*F)(void *t);
+  unsigned long generation;
+  int pending;
+  bool stop;
+  std::exception_ptr error;
+};
+
+void *snet_worker_t(void *t) {
+  auto *targs = (tdata *) t;
+  SnetPool *pool = targs->pool;
+  unsigned long seen = 0;
+
+  while (true) {
+    pthread_mutex_lock(&pool->mtx);
+    while (!pool->stop && pool->generation == seen)
+      pthread_cond_wait(&pool->start_cv, &pool->mtx);
+    if (pool->stop) {
+      pthread_mutex_unlock(&pool->mtx);
+      break;
+    }
+    seen = pool->generation;
+    void *(*F)(void *t) = pool->F;
+    pthread_mutex_unlock(&pool->mtx);
+
+    std::exception_ptr error = nullptr;
+    try {
+      (*F)(t);
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+
+    pthread_mutex_lock(&pool->mtx);
+    if (error && !pool->error) pool->error = error;
+    if (--pool->pending == 0) pthread_cond_signal(&pool->done_cv);
+    pthread_mutex_unlock(&pool->mtx);
+  }
+
+  return nullptr;
+}
+
+void Net::stop_snets()
+{
+  if (pool == nullptr) return;
+
+  pthread_mutex_lock(&pool->mtx);
+  pool->stop = true;
+  pthread_cond_broadcast(&pool->start_cv);
+  pthread_mutex_unlock(&pool->mtx);
+
+  for (int i = 0; i < pool->thr.size(); i++)
+    pthread_join(pool->thr[i], nullptr);
+
+  pthread_mutex_destroy(&pool->mtx);
+  pthread_cond_destroy(&pool->start_cv);
+  pthread_cond_destroy(&pool->done_cv);
+
+  delete pool;
+  pool = nullptr;
+}
+
 /////////////////////////////////////////
 // "a ring to rule them all"
 void Net::run_snets(void *(*F)(void *t))
 {
-  void *status;
   int rc;
-  pthread_t thr[100];
-  struct tdata td[100];
-
   int comp=snets.size();
 
-  for (int i = 0; i < comp; i++) {
-    // Thread params
-    td[i].net = snets[i];
+  if (comp == 0) return;
 
-    rc = pthread_create(&thr[i], nullptr, (*F), (void *) (&td[i]));
-    if (rc) {
-      throw std::runtime_error("unable to create thread " + std::to_string(rc));
-    }
+  // Nothing to synchronize, run it in the caller thread
+  if (comp == 1) {
+    struct tdata td;
+    td.net = snets[0];
+    td.pool = nullptr;
+    (*F)((void *) (&td));
+    return;
   }
 
-  // Wait until all threads have finished
-  for (int i = 0; i < comp; i++) {
-    rc = pthread_join(thr[i], &status);
-    if (rc) {
-      throw std::runtime_error("unable to join thread " + std::to_string(rc));
+  // (Re)create the workers when the number of snets changes
+  if ((pool != nullptr) && (pool->thr.size() != (size_t) comp)) stop_snets();
+
+  if (pool == nullptr) {
+    pool = new SnetPool;
+    pthread_mutex_init(&pool->mtx, nullptr);
+    pthread_cond_init(&pool->start_cv, nullptr);
+    pthread_cond_init(&pool->done_cv, nullptr);
+    pool->F = nullptr;
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->stop = false;
+    pool->error = nullptr;
+    pool->thr.resize(comp);
+    pool->td.resize(comp);
+
+    for (int i = 0; i < comp; i++) {
+      pool->td[i].net = snets[i];
+      pool->td[i].pool = pool;
+
+      rc = pthread_create(&pool->thr[i], nullptr, snet_worker_t, (void *) (&pool->td[i]));
+      if (rc) {
+        pool->thr.resize(i);
+        stop_snets();
+        throw std::runtime_error("unable to create thread " + std::to_string(rc));
+      }
     }
   }
+
+  // Dispatch and wait until all workers have finished
+  pthread_mutex_lock(&pool->mtx);
+  for (int i = 0; i < comp; i++)
+    pool->td[i].net = snets[i];
+  pool->F = F;
+  pool->pending = comp;
+  pool->error = nullptr;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start_cv);
+
+  while (pool->pending > 0)
+    pthread_cond_wait(&pool->done_cv, &pool->mtx);
+
+  std::exception_ptr error = pool->error;
+  pool->error = nullptr;
+  pthread_mutex_unlock(&pool->mtx);
+
+  if (error) std::rethrow_exception(error);
 }
 
 
@@ -648,7 +760,7 @@ void Net::delta()
 //////////////////////////////////////////////////////////////
 //////// HIGHER LEVEL FUNCS
 void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
-  int i, j, k, n;
+  int i, j, n;
 
   if (isrecurrent) {
     fit_recurrent(tin,tout, batch, epochs);
@@ -689,36 +801,33 @@ void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
     resize(batch);
 
 
-    // Create array to store batch indices (later random)
-    vind sind;
-    for (i = 0; i < batch_size; i++)
-    sind.push_back(0);
-
+    // Batches are gathered in the background while the previous one trains.
+    // They arrive in order, so the snets take them as they are
+    Prefetcher loader(tin, tout, batch_size, true);
+    vtensor bx, by;
 
     // Start training
     setmode(TRMODE);
 
     // Set some parameters
-    int num_batches = n / batch_size;
+    int num_batches = loader.num_batches;
 
     // Train network
     fprintf(stdout, "%d epochs of %d batches of size %d\n", epochs, num_batches, batch_size);
     for (i = 0; i < epochs; i++) {
       high_resolution_clock::time_point e1 = high_resolution_clock::now();
+      double stall = loader.stall_time;
       fprintf(stdout, "Epoch %d\n", i + 1);
 
       reset_loss();
 
       // For each batch
-      for (j = 0; j < num_batches; j++) {
-
-        // Set random indices
-        for (k = 0; k < batch_size; k++) sind[k] = rand() % n;
+      for (j = 0; loader.next(bx, by); j++) {
 
         // Train batch
         tr_batches++;
 
-        train_batch(tin, tout, sind);
+        train_batch_ordered(bx, by);
 
         print_loss(j+1);
 
@@ -731,7 +840,7 @@ void Net::fit(vtensor tin, vtensor tout, int batch, int epochs) {
       }
       high_resolution_clock::time_point e2 = high_resolution_clock::now();
       duration<double> epoch_time_span = e2 - e1;
-      fprintf(stdout, "\n%1.3f secs/epoch\n", epoch_time_span.count());
+      fprintf(stdout, "\n%1.3f secs/epoch (%1.3f secs waiting for data)\n", epoch_time_span.count(), loader.stall_time - stall);
     }
     fflush(stdout);
   }
@@ -925,6 +1034,64 @@ void Net::train_batch(vtensor X, vtensor Y, vind sind, int eval) {
 }
 
 
+// t uses the data at ptr until it is given back (see train_batch_ordered)
+static void lend_data(Tensor *t, float *ptr, bool shared) {
+  if (t->ndim == 2) { delete t->ptr2; t->ptr2 = nullptr; }
+  t->updateData(ptr);
+  t->isshared = shared;
+}
+
+// A batch already in order (see Prefetcher): the snets take their rows as
+// they are. CPU inputs and targets point at the batch while it trains,
+// the others get one copy instead of the select and copy of train_batch
+void Net::train_batch_ordered(vtensor X, vtensor Y) {
+  if (batch_size!=X[0]->shape[0]) resize(X[0]->shape[0]);
+
+  int comp=snets.size();
+  int thread_batch_size=batch_size / comp;
+
+  setmode(TRMODE);
+
+  vector<Tensor *> lent;
+  vector<float *> own;
+  auto hand = [&](Tensor *A, Tensor *B, int start) {
+    float *ptr = A->ptr + (size_t)start * A->stride[0];
+    if ((B->isCPU()) && (!B->isshared)) {
+      lent.push_back(B);
+      own.push_back(B->ptr);
+      lend_data(B, ptr, true);
+    }
+    else if ((start == 0) && (A->shape[0] == B->shape[0])) Tensor::copy(A, B);
+    else {
+      Tensor *rows = new Tensor(B->shape, ptr, DEV_CPU);
+      rows->isshared = true;
+      Tensor::copy(rows, B);
+      delete rows;
+    }
+  };
+
+  for (int i = 0; i < comp; i++) {
+    int start = i * thread_batch_size;
+    for (int j = 0; j < X.size(); j++)
+      hand(X[j], snets[i]->lin[j]->input, start);
+    for (int j = 0; j < Y.size(); j++) {
+      snets[i]->lout[j]->check_target();
+      hand(Y[j], snets[i]->lout[j]->target, start);
+    }
+  }
+
+  run_snets(train_batch_t);
+
+  if ((snets[0]->dev != DEV_CPU) && (comp > 1) && (tr_batches%cs->lsb==0)) {
+    sync_weights();
+  }
+
+  compute_loss();
+
+  for (int i = 0; i < lent.size(); i++) lend_data(lent[i], own[i], false);
+}
+
+
 ///////////////////////////////////////////
 void Net::evaluate(vtensor tin, vtensor tout) {
 
@@ -21,6 +21,7 @@
 #include "eddl/random.h"
 
 #include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/conv/layer_conv.h"
 
 #ifdef cGPU
 #include "eddl/hardware/gpu/gpu_tensor.h"
@@ -293,6 +294,16 @@ void Net::set_compserv(CompServ *cs){
 
                 snets.push_back(this);
 
+                // Convolutions lower their input in one buffer for the net,
+                // as much of it as the mem_level allows
+                conv_ws=new ConvolWorkspace();
+                for(int i=0;i<layers.size();i++) {
+                    LConv *l=dynamic_cast<LConv *>(layers[i]);
+                    LConvT *t=dynamic_cast<LConvT *>(layers[i]);
+                    if (l!=nullptr) l->cd->set_workspace(conv_ws, mem_level);
+                    if (t!=nullptr) t->cd->set_workspace(conv_ws, mem_level);
+                }
+
             } else {
                 msg("Net and Layers device missmatch", "Net.set_compserv");
             }
@@ -489,9 +500,13 @@ void Net::resize(int b)
     m = batch_size % c;
   }
 
+  // The deltas are booked again (mem_delta) with the new batch, also the
+  // ones kept with full_mem. Layers such as LConv cache them when booked
+  int ind;
   for (j = 0; j < layers.size(); j++) {
 //      cout << "[DEBUG]: resizing layer " << layers[j]->name << endl;
       layers[j]->resize(batch_size);
+      if ((layers[j]->delta!=nullptr)&&(!isIn(layers[j],lin,ind))) layers[j]->free_delta();
   }
 
   for(i=0; i<c; i++) {
@@ -502,6 +517,7 @@ void Net::resize(int b)
     snets[i]->batch_size=bs;
     for (j = 0; j < snets[i]->layers.size(); j++) {
         snets[i]->layers[j]->resize(bs);
+        if ((snets[i]->layers[j]->delta!=nullptr)&&(!isIn(snets[i]->layers[j],snets[i]->lin,ind))) snets[i]->layers[j]->free_delta();
       }
 
     for (j = 0; j < snets[i]->lin.size(); j++)
@@ -511,6 +527,9 @@ void Net::resize(int b)
         Ys[i].push_back(new Tensor(snets[i]->lout[j]->output->shape));
   }
 
+  alias_concats();
+  if (isplanned) assign_memory();
+
   reset();
 
 }
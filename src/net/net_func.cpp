@@ -20,6 +20,7 @@
 #include "eddl/utils.h"
 #include "eddl/random.h"
 #include "eddl/layers/core/layer_core.h"
+#include "eddl/hardware/cpu/cpu_profile.h"
 
 #define VERBOSE 0
 
@@ -59,7 +60,9 @@ void Net::do_forward() {
       fprintf(stdout, "  %s In[%d,%s]:%f\n", vfts[i]->name.c_str(), j, vfts[i]->parent[j]->name.c_str(),vfts[i]->parent[j]->output->sum());
     }
 
+    if (_profile_enabled) _profile_scope_begin(vfts[i]->name, "forward");
     vfts[i]->forward();
+    if (_profile_enabled) _profile_scope_end();
     if (VERBOSE) {
       fprintf(stdout, "  %s Out:%f\n", vfts[i]->name.c_str(), vfts[i]->output->sum());
     }
@@ -71,6 +74,7 @@ void Net::do_forward() {
 }
 
 void Net::do_backward() {
+  if (isinference) msg("Net optimized for inference, backward is not available", "Net.do_backward");
   if (VERBOSE) {
     cout<<"START BACKWARD\n";
   }
@@ -87,7 +91,9 @@ void Net::do_backward() {
       cout << "backward "<<vbts[i]->name << " delta="<<vbts[i]->delta->sum()<<"\n";
     }
 
+    if (_profile_enabled) _profile_scope_begin(vbts[i]->name, "backward");
     vbts[i]->backward();
+    if (_profile_enabled) _profile_scope_end();
 
 
     // Delete this delta
@@ -139,8 +145,24 @@ void Net::do_compute_loss() {
   }
 }
 
+// Training step: loss value and output deltas (fused by the losses that support it)
+void Net::do_compute_loss_delta() {
+  int p = 0;
+  for (int i = 0; i < lout.size(); i++, p += 2) {
+    lout[i]->mem_delta();
+    // loss value + delta
+    if (losses.size()>=(i+1))
+    fiterr[p] = losses[i]->value_delta(lout[i]->target, lout[i]->output, lout[i]->delta);
+    // metric value
+    if (metrics.size()>=(i+1))
+    fiterr[p + 1] = metrics[i]->value(lout[i]->target, lout[i]->output);
+  }
+}
+
 void Net::do_applygrads() {
+  if (_profile_enabled) _profile_scope_begin("optimizer", "update");
   optimizer->applygrads(batch_size);
+  if (_profile_enabled) _profile_scope_end();
 }
 
 
@@ -163,6 +185,7 @@ void Net::sync_weights() {
     }
 
   }
+  for (int j = 0; j < layers.size(); j++) layers[j]->params_changed();
 }
 
 
@@ -0,0 +1,535 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+#include "eddl/net/net.h"
+#include "eddl/utils.h"
+
+#include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/conv/layer_conv.h"
+#include "eddl/layers/normalization/layer_normalization.h"
+#include "eddl/layers/merge/layer_merge.h"
+
+using namespace std;
+
+static void release_arena(Net *net);
+
+
+/////////////////////////////////////////
+//// INFERENCE OPTIMIZATION
+/////////////////////////////////////////
+
+// Conv and Dense layers can absorb a following BatchNorm and activation
+static int *fused_act(Layer *l) {
+    LConv *c=dynamic_cast<LConv *>(l);
+    if (c!=nullptr) return &c->cd->fused_act;
+    LDense *d=dynamic_cast<LDense *>(l);
+    if (d!=nullptr) return &d->fused_act;
+    return nullptr;
+}
+
+static int act_code(LActivation *l) {
+    if (l->act=="relu") return FUSED_ACT_RELU;
+    if (l->act=="sigmoid") return FUSED_ACT_SIGMOID;
+    if (l->act=="tanh") return FUSED_ACT_TANH;
+    return FUSED_ACT_NONE;
+}
+
+// Quantized weights (see quantize) are built again from the float ones, with
+// the same input range. Without them (quantize frees them unless keep_float)
+// the quantized weights are scaled
+static void requantize(QuantDescriptor *&qd, Tensor *K, bool channels_last, const vector<float> &scale) {
+    if (qd==nullptr) return;
+    if (K->ptr==nullptr) { qd->scale(scale); return; }
+    QuantDescriptor *q=new QuantDescriptor(K, channels_last, qd->dtype);
+    q->in_min=qd->in_min;
+    q->in_max=qd->in_max;
+    q->in_scale=qd->in_scale;
+    q->in_zero=qd->in_zero;
+    delete qd;
+    qd=q;
+}
+
+// y=x*scale+shift per channel, with the running statistics
+static void fold_batchnorm(Layer *l, LBatchNorm *bn) {
+    int n=bn->mean->size;
+    vector<float> scale(n), shift(n);
+    for(int c=0;c<n;c++) {
+        float g=(bn->affine) ? bn->bn_g->ptr[c] : 1.0f;
+        float b=(bn->affine) ? bn->bn_b->ptr[c] : 0.0f;
+        scale[c]=g/std::sqrt(bn->variance->ptr[c]+bn->epsilon);
+        shift[c]=b-bn->mean->ptr[c]*scale[c];
+    }
+
+    LConv *conv=dynamic_cast<LConv *>(l);
+    if (conv!=nullptr) {
+        ConvolDescriptor *cd=conv->cd;
+        int ksize=cd->K->size/cd->nk;  // K is {nk,kz,kr,kc}
+        for(int c=0;c<n;c++) {
+            if (cd->K->ptr!=nullptr) {
+                float *k=cd->K->ptr+c*ksize;
+                for(int i=0;i<ksize;i++) k[i]*=scale[c];
+            }
+            float b=(cd->use_bias) ? cd->bias->ptr[c] : 0.0f;
+            cd->bias->ptr[c]=b*scale[c]+shift[c];
+        }
+        cd->use_bias=true;
+        requantize(cd->qd, cd->K, false, scale);
+        return;
+    }
+
+    LDense *dense=dynamic_cast<LDense *>(l);
+    if (!dense->use_bias) {
+        dense->bias=Tensor::zeros({n}, dense->dev);
+        dense->gbias=Tensor::zeros({n}, dense->dev);
+        dense->params.push_back(dense->bias);
+        dense->gradients.push_back(dense->gbias);
+        dense->use_bias=true;
+    }
+    float *w=dense->W->ptr;  // W is {in,n}
+    if (w!=nullptr)
+        for(int i=0;i<dense->W->shape[0];i++)
+            for(int c=0;c<n;c++) w[i*n+c]*=scale[c];
+    for(int c=0;c<n;c++)
+        dense->bias->ptr[c]=dense->bias->ptr[c]*scale[c]+shift[c];
+    requantize(dense->qd, dense->W, true, scale);
+}
+
+// Removes l (the only child of p) from the graph: p writes the output of l
+// from now on, so the children of l and the net tensors are kept as they are
+static void absorb_layer(Net *net, Layer *p, Layer *l) {
+    int ind;
+
+    delete p->output;
+    p->output=l->output;
+    l->output=nullptr;
+    LConv *conv=dynamic_cast<LConv *>(p);
+    if (conv!=nullptr) conv->cd->O=p->output;
+
+    p->child=l->child;
+    p->lout=l->lout;
+    for(int i=0;i<l->child.size();i++)
+        for(int j=0;j<l->child[i]->parent.size();j++)
+            if (l->child[i]->parent[j]==l) l->child[i]->parent[j]=p;
+
+    if (isIn(l,net->layers,ind)) net->layers.erase(net->layers.begin()+ind);
+    if (isIn(l,net->vfts,ind)) net->vfts.erase(net->vfts.begin()+ind);
+    if (isIn(l,net->vbts,ind)) net->vbts.erase(net->vbts.begin()+ind);
+
+    delete l;
+}
+
+void Net::optimize_inference() {
+    int ind;
+
+    if (!isbuild) msg("The net must be built first", "Net.optimize_inference");
+    if (isrecurrent) msg("Recurrent nets are not supported", "Net.optimize_inference");
+    if (dev!=DEV_CPU) msg("Only implemented for CPU", "Net.optimize_inference");
+
+    setmode(TSMODE);
+
+    int nbn=0, nact=0;
+    for(int i=0;i<vfts.size();i++) {
+        Layer *p=vfts[i];
+        int *act=fused_act(p);
+        if ((act==nullptr)||(p->net!=this)||(p->isshared)||(isIn(p,lout,ind))) continue;
+
+        // Conv/Dense -> [BatchNorm] -> [ReLU|Sigmoid|Tanh]
+        while (p->child.size()==1) {
+            Layer *l=p->child[0];
+            if ((l->parent.size()!=1)||(l->net!=this)||(l->isshared)||(isIn(l,lout,ind))) break;
+
+            LBatchNorm *bn=dynamic_cast<LBatchNorm *>(l);
+            LActivation *a=dynamic_cast<LActivation *>(l);
+
+            if ((bn!=nullptr)&&(*act==FUSED_ACT_NONE)) {
+                fold_batchnorm(p,bn);
+                nbn++;
+            }
+            else if ((a!=nullptr)&&(*act==FUSED_ACT_NONE)&&(act_code(a)!=FUSED_ACT_NONE)) {
+                *act=act_code(a);
+                nact++;
+            }
+            else break;
+
+            absorb_layer(this,p,l);
+        }
+    }
+
+    isinference=true;
+    if (isplanned) assign_memory();  // the absorbed layers were written later
+
+    if (verbosity_level>=1)
+        cout<<name<<": "<<nbn<<" BatchNorm folded, "<<nact<<" activations fused\n";
+}
+
+
+/////////////////////////////////////////
+//// INT8 / 16-BIT QUANTIZATION
+/////////////////////////////////////////
+
+void Net::quantize(vector<Tensor *> calibration, const string& dtype, bool keep_float) {
+    int qtype=get_dtype(dtype);
+
+    if (!isbuild) msg("The net must be built first", "Net.quantize");
+    if (isrecurrent) msg("Recurrent nets are not supported", "Net.quantize");
+    if (dev!=DEV_CPU) msg("Only implemented for CPU", "Net.quantize");
+    if (qtype==DTYPE_FLOAT32) msg("Weights are float32 already", "Net.quantize");
+    if ((qtype==DTYPE_INT8)&&(calibration.size()!=lin.size())) msg("One calibration tensor per input is expected", "Net.quantize");
+
+    // Dense and Conv layers, with their float weights (grouped convolutions
+    // are kept in float)
+    vector<Layer *> ql;
+    vector<QuantDescriptor *> qds;
+    size_t fbytes=0, qbytes=0;
+    for(int i=0;i<layers.size();i++) {
+        Layer *l=layers[i];
+        if ((l->net!=this)||(l->isshared)) continue;
+
+        LDense *d=dynamic_cast<LDense *>(l);
+        LConv *c=dynamic_cast<LConv *>(l);
+        QuantDescriptor *qd=nullptr;
+        if ((d!=nullptr)&&(d->qd==nullptr)) qd=new QuantDescriptor(d->W, true, qtype);
+        else if ((c!=nullptr)&&(c->cd->qd==nullptr)&&(c->cd->groups==1)) qd=new QuantDescriptor(c->cd->K, false, qtype);
+        else continue;
+
+        ql.push_back(l);
+        qds.push_back(qd);
+        fbytes+=(size_t)qd->nout*qd->nin*sizeof(float);
+        qbytes+=qd->bytes();
+    }
+
+    // Input ranges from a float forward pass. A planned net keeps every
+    // output meanwhile, the arena overwrites the ones already consumed
+    setmode(TSMODE);
+    bool replan=(qtype==DTYPE_INT8)&&(isplanned);
+    if (replan) { isplanned=false; release_arena(this); }
+    if (qtype==DTYPE_INT8) forward(calibration);
+    for(int i=0;i<ql.size();i++) {
+        if (qtype==DTYPE_INT8) {
+            qds[i]->calibrate(ql[i]->input);
+            qds[i]->set_range();
+        }
+
+        LDense *d=dynamic_cast<LDense *>(ql[i]);
+        if (d!=nullptr) d->qd=qds[i];
+        else ((LConv *)ql[i])->cd->qd=qds[i];
+
+        // The float weights and their gradients are not used anymore
+        if (!keep_float) {
+            if (d!=nullptr) { d->W->deleteData(); d->gW->deleteData(); }
+            else { ((LConv *)ql[i])->cd->K->deleteData(); ((LConv *)ql[i])->cd->gK->deleteData(); }
+        }
+    }
+    if (replan) { isplanned=true; assign_memory(); }
+
+    isinference=true;
+
+    if (verbosity_level>=1)
+        cout<<name<<": "<<ql.size()<<" layers quantized to "<<dtype<<", weights "
+            <<fbytes/1048576.0<<" MB -> "<<qbytes/1048576.0<<" MB\n";
+}
+
+
+/////////////////////////////////////////
+//// IN-PLACE CONCATENATION
+/////////////////////////////////////////
+
+// A parent can write into the output of c if it owns the data of its output
+// (neither its parents nor its other children share it, as Reshape does)
+// and it is not the parent of another in-place concat
+static bool can_alias(Net *net, LConcat *c, Layer *p, vector<Layer *> &used) {
+    int ind;
+
+    if ((p->net!=net)||(p->isshared)||(p->parent.empty())||(isIn(p,used,ind))) return false;
+    for(int i=0;i<p->parent.size();i++)
+        if (p->parent[i]->output->ptr==p->output->ptr) return false;
+    for(int i=0;i<p->child.size();i++)
+        if ((p->child[i]!=c)&&(p->child[i]->output->ptr==p->output->ptr)) return false;
+    return true;
+}
+
+// With a batch larger than 1 a slice over the channels is strided. LConv
+// writes its output and reads its delta with the batch stride of the tensor;
+// nothing else may read them, so c must be its only child
+static bool can_stride(Net *net, LConcat *c, Layer *p) {
+    int ind;
+
+    if ((c->axis!=1)||(p->output->ndim!=4)||(dynamic_cast<LConv *>(p)==nullptr)) return false;
+    return (p->child.size()==1)&&(!isIn(p,net->lout,ind));
+}
+
+void Net::inplace_concat() {
+    if (!isbuild) msg("The net must be built first", "Net.inplace_concat");
+    if (isrecurrent) msg("Recurrent nets are not supported", "Net.inplace_concat");
+    if (dev!=DEV_CPU) msg("Only implemented for CPU", "Net.inplace_concat");
+
+    release_arena(this);  // see plan_memory, the outputs must be apart
+
+    vector<Layer *> used;
+    for(int i=0;i<layers.size();i++) {
+        LConcat *c=dynamic_cast<LConcat *>(layers[i]);
+        if ((c!=nullptr)&&(c->inplace)) used.insert(used.end(),c->parent.begin(),c->parent.end());
+    }
+
+    int n=0;
+    for(int i=0;i<vfts.size();i++) {
+        LConcat *c=dynamic_cast<LConcat *>(vfts[i]);
+        if ((c==nullptr)||(c->inplace)||(c->net!=this)||(c->isshared)) continue;
+
+        // (a layer twice in the same concat is not either)
+        bool ok=true;
+        vector<Layer *> seen=used;
+        for(int j=0;(j<c->parent.size())&&(ok);j++) {
+            ok=can_alias(this,c,c->parent[j],seen);
+            seen.push_back(c->parent[j]);
+        }
+        if (!ok) continue;
+
+        c->strided.clear();
+        for(int j=0;j<c->parent.size();j++) c->strided.push_back(can_stride(this,c,c->parent[j]));
+        c->inplace=true;
+        used=seen;
+        n++;
+    }
+
+    alias_concats();
+    if (isplanned) assign_memory();
+
+    if (verbosity_level>=1)
+        cout<<name<<": "<<n<<" Concat layers in place\n";
+}
+
+// After a resize: consumers first, so nested concats end up in the outermost buffer
+void Net::alias_concats() {
+    for(int i=vfts.size()-1;i>=0;i--) {
+        LConcat *c=dynamic_cast<LConcat *>(vfts[i]);
+        if ((c!=nullptr)&&(c->inplace)) c->alias_parents();
+    }
+}
+
+
+/////////////////////////////////////////
+//// ACTIVATION MEMORY PLANNING
+/////////////////////////////////////////
+
+#define ARENA_ALIGN 16  // floats, 64 bytes
+
+// Layers whose outputs share the same data: Reshape and its parent, the
+// parents of an in-place Concat and the Concat, and a layer working in place
+// and its parent
+struct MemBlock {
+    vector<Layer *> layers;
+    vector<long> at;    // offset of each output in the block
+    vector<bool> own;   // the output owns its data
+    long size;
+    int first, last;    // forward steps where the block is written first and read last
+    bool pinned;        // inputs and outputs of the net keep their own memory
+    bool merged;
+    long offset;        // in the arena
+};
+
+// The output can overwrite the input (the same element is read and written once)
+static bool elementwise(Layer *l) {
+    LActivation *a=dynamic_cast<LActivation *>(l);
+    if (a!=nullptr) return a->act!="softmax";
+    return dynamic_cast<LDropout *>(l)!=nullptr;
+}
+
+// Back to one buffer per output (Reshape shares the one of its parent),
+// then the Concat layers take their parents again
+static void release_arena(Net *net) {
+    if (net->arena==nullptr) return;
+
+    vector<Tensor *> done;
+    for(int i=0;i<net->vfts.size();i++) {
+        Tensor *o=net->vfts[i]->output;
+        if ((o->ptr<net->arena)||(o->ptr>=net->arena+net->arena_size)||(std::find(done.begin(),done.end(),o)!=done.end())) continue;
+        done.push_back(o);
+        o->deleteData();
+        LReshape *r=dynamic_cast<LReshape *>(net->vfts[i]);
+        if (r!=nullptr) { o->updateData(r->parent[0]->output->ptr); o->isshared=true; }
+        else o->updateData(nullptr);
+    }
+    free_fmem(net->arena);
+    net->arena=nullptr;
+    net->arena_size=0;
+    net->alias_concats();
+}
+
+void Net::plan_memory() {
+    if (!isbuild) msg("The net must be built first", "Net.plan_memory");
+    if (isrecurrent) msg("Recurrent nets are not supported", "Net.plan_memory");
+    if (dev!=DEV_CPU) msg("Only implemented for CPU", "Net.plan_memory");
+
+    // The outputs of the hidden layers are overwritten once they are consumed,
+    // and the deltas are not needed anymore
+    setmode(TSMODE);
+    int ind;
+    for(int i=0;i<layers.size();i++)
+        if ((layers[i]->delta!=nullptr)&&(!isIn(layers[i],lin,ind))) layers[i]->free_delta();
+
+    isinference=true;
+    isplanned=true;
+    assign_memory();
+}
+
+// Called again after every resize or change of the graph. The activations
+// are rewritten by every forward, so nothing is copied
+void Net::assign_memory() {
+    int ind;
+    int n=vfts.size();
+
+    release_arena(this);
+
+    // Blocks from the data the outputs point to now, the largest first so
+    // the owner of the data comes before the layers that share it
+    vector<int> order(n);
+    for(int i=0;i<n;i++) order[i]=i;
+    std::stable_sort(order.begin(),order.end(),[this](int a, int b){ return vfts[a]->output->size>vfts[b]->output->size; });
+
+    vector<MemBlock> blocks;
+    vector<int> blk(n,-1);
+    for(int k=0;k<n;k++) {
+        Layer *l=vfts[order[k]];
+        Tensor *o=l->output;
+        for(int b=0;(b<blocks.size())&&(blk[order[k]]<0);b++) {
+            Tensor *r=blocks[b].layers[0]->output;
+            if ((o->ptr>=r->ptr)&&(o->ptr+o->size<=r->ptr+r->size)) {
+                blk[order[k]]=b;
+                blocks[b].layers.push_back(l);
+                blocks[b].at.push_back(o->ptr-r->ptr);
+                blocks[b].own.push_back(false);
+            }
+        }
+        if (blk[order[k]]>=0) continue;
+
+        MemBlock m;
+        m.layers.push_back(l);
+        m.at.push_back(0);
+        m.own.push_back(!o->isshared);
+        m.size=o->size;
+        m.first=n; m.last=-1;
+        m.pinned=false; m.merged=false;
+        m.offset=0;
+        blk[order[k]]=blocks.size();
+        blocks.push_back(m);
+    }
+
+    // Lifetimes, in forward steps
+    for(int i=0;i<n;i++) {
+        Layer *l=vfts[i];
+        MemBlock &m=blocks[blk[i]];
+        m.first=std::min(m.first,i);
+        m.last=std::max(m.last,i);
+        if ((isIn(l,lin,ind))||(isIn(l,lout,ind))||(l->net!=this)||(l->isshared)) m.pinned=true;
+        for(int j=0;j<l->child.size();j++) {
+            if (isIn(l->child[j],vfts,ind)) m.last=std::max(m.last,ind);
+            else m.pinned=true;
+        }
+    }
+
+    // In place: the only input of an elementwise layer that is read for the
+    // last time there
+    for(int i=0;i<n;i++) {
+        Layer *l=vfts[i];
+        if ((!elementwise(l))||(l->parent.size()!=1)||(!isIn(l->parent[0],vfts,ind))) continue;
+        MemBlock &m=blocks[blk[i]];
+        MemBlock &pm=blocks[blk[ind]];
+        if ((&m==&pm)||(m.pinned)||(pm.pinned)||(m.layers[0]!=l)||(m.first!=i)||(pm.last!=i)) continue;
+        if (l->output->size!=l->parent[0]->output->size) continue;
+
+        long at=pm.at[std::find(pm.layers.begin(),pm.layers.end(),l->parent[0])-pm.layers.begin()];
+        for(int j=0;j<m.layers.size();j++) {
+            pm.layers.push_back(m.layers[j]);
+            pm.at.push_back(at+m.at[j]);
+            pm.own.push_back(m.own[j]);
+        }
+        pm.last=m.last;
+        m.merged=true;
+        int from=blk[i];
+        for(int j=0;j<n;j++)
+            if (blk[j]==from) blk[j]=blk[ind];
+    }
+
+    // Offsets: greedy by size, the lowest gap free during the whole lifetime
+    vector<MemBlock *> planned;
+    for(int b=0;b<blocks.size();b++)
+        if ((!blocks[b].pinned)&&(!blocks[b].merged)) planned.push_back(&blocks[b]);
+    std::stable_sort(planned.begin(),planned.end(),[](MemBlock *a, MemBlock *b){ return a->size>b->size; });
+
+    long total=0;
+    vector<MemBlock *> placed;
+    for(auto *m : planned) {
+        vector<MemBlock *> live;
+        for(auto *p : placed)
+            if ((p->first<=m->last)&&(m->first<=p->last)) live.push_back(p);
+        std::sort(live.begin(),live.end(),[](MemBlock *a, MemBlock *b){ return a->offset<b->offset; });
+
+        long off=0;
+        for(auto *p : live) {
+            if (off+m->size<=p->offset) break;
+            off=std::max(off,p->offset+p->size);
+            off=(off+ARENA_ALIGN-1)/ARENA_ALIGN*ARENA_ALIGN;
+        }
+        m->offset=off;
+        total=std::max(total,off+m->size);
+        placed.push_back(m);
+    }
+
+    // Move the outputs (the tensors themselves are kept, other layers may hold them)
+    arena=(total>0) ? get_fmem(total,"Net::assign_memory") : nullptr;
+    arena_size=total;
+    vector<Tensor *> done;
+    for(auto *m : planned)
+        for(int j=0;j<m->layers.size();j++) {
+            Tensor *o=m->layers[j]->output;
+            if (std::find(done.begin(),done.end(),o)!=done.end()) continue;  // the same tensor in two layers
+            done.push_back(o);
+            if (!m->own[j]) o->isshared=true;
+            o->deleteData();
+            o->updateData(arena+m->offset+m->at[j]);
+            o->isshared=true;
+        }
+
+    if (verbosity_level>=1) {
+        // Training keeps every output until the backward, and the deltas
+        // live as mem_level allows (see do_backward)
+        long outputs=0, pinned=0, deltas=0, peak=0;
+        for(int b=0;b<blocks.size();b++) {
+            if (blocks[b].merged) continue;
+            outputs+=blocks[b].size;
+            if (blocks[b].pinned) pinned+=blocks[b].size;
+        }
+        if (!mem_level) peak=outputs;
+        else {
+            vector<bool> alive(blocks.size(),false);
+            vector<Layer *> booked=lout;
+            for(int i=0;i<vbts.size();i++) {
+                booked.insert(booked.end(),vbts[i]->parent.begin(),vbts[i]->parent.end());
+                for(auto *l : booked)
+                    if ((isIn(l,vfts,ind))&&(!alive[blk[ind]])) { alive[blk[ind]]=true; deltas+=blocks[blk[ind]].size; }
+                booked.clear();
+                peak=std::max(peak,deltas);
+                if ((!isIn(vbts[i],lin,ind))&&(isIn(vbts[i],vfts,ind))&&(alive[blk[ind]])) {
+                    alive[blk[ind]]=false;
+                    deltas-=blocks[blk[ind]].size;
+                }
+            }
+        }
+        float mb=sizeof(float)/1048576.0f;
+        cout<<name<<": activations, training "<<(outputs+peak)*mb<<" MB (outputs "<<outputs*mb<<" MB + deltas "<<peak*mb
+            <<" MB), inference "<<outputs*mb<<" MB -> "<<(pinned+total)*mb<<" MB ("<<planned.size()<<" blocks in "<<total*mb<<" MB)\n";
+    }
+}
@@ -0,0 +1,210 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+
+
+#include <cstdio>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include "eddl/net/prefetcher.h"
+#include "eddl/random.h"
+#include "eddl/utils.h"
+
+using namespace std;
+using namespace std::chrono;
+
+
+Prefetcher::Prefetcher(vector<Tensor *> X, vector<Tensor *> Y, int batch_size, bool shuffle, int depth) {
+    for (auto t : X) { wrapped.push_back(new Dataset(t)); this->X.push_back(wrapped.back()); }
+    for (auto t : Y) { wrapped.push_back(new Dataset(t)); this->Y.push_back(wrapped.back()); }
+    this->batch_size = batch_size;
+    this->shuffle = shuffle;
+    this->depth = depth;
+    init();
+}
+
+Prefetcher::Prefetcher(vector<Dataset *> X, vector<Dataset *> Y, int batch_size, bool shuffle, int depth) {
+    this->X = X;
+    this->Y = Y;
+    this->batch_size = batch_size;
+    this->shuffle = shuffle;
+    this->depth = depth;
+    init();
+}
+
+void Prefetcher::init() {
+    if (X.empty()) msg("No input tensors", "Prefetcher");
+    if (depth < 1) msg("The depth must be at least 1", "Prefetcher");
+
+    num_samples = X[0]->num_samples;
+    for (auto d : X) if (d->num_samples != num_samples) msg("different number of samples in input tensor", "Prefetcher");
+    for (auto d : Y) if (d->num_samples != num_samples) msg("different number of samples in output tensor", "Prefetcher");
+
+    num_batches = num_samples / batch_size;
+    if (num_batches == 0) msg("batch_size larger than the number of samples", "Prefetcher");
+
+    // Slots, allocated once
+    sx.resize(depth);
+    sy.resize(depth);
+    for (int s = 0; s < depth; s++) {
+        for (auto d : X) {
+            vector<int> shape(d->shape);
+            shape[0] = batch_size;
+            sx[s].push_back(new Tensor(shape, DEV_CPU));
+        }
+        for (auto d : Y) {
+            vector<int> shape(d->shape);
+            shape[0] = batch_size;
+            sy[s].push_back(new Tensor(shape, DEV_CPU));
+        }
+    }
+
+    perm.resize(num_samples);
+    std::iota(perm.begin(), perm.end(), 0);
+
+    // Private generator, so the order does not depend on other threads
+    uint32_t r[4];
+    philox4x32(reserve_random_counters(1), get_random_seed(), r);
+    rng.seed(r[0]);
+
+    stall_time = 0.0;
+    stalls = 0;
+    produced = consumed = released = 0;
+    pos = 0;
+    running = false;
+    halt = false;
+    error = nullptr;
+
+    pthread_mutex_init(&mtx, nullptr);
+    pthread_cond_init(&ready_cv, nullptr);
+    pthread_cond_init(&free_cv, nullptr);
+}
+
+Prefetcher::~Prefetcher() {
+    stop();
+
+    pthread_mutex_destroy(&mtx);
+    pthread_cond_destroy(&ready_cv);
+    pthread_cond_destroy(&free_cv);
+
+    for (int s = 0; s < depth; s++) {
+        for (auto t : sx[s]) delete t;
+        for (auto t : sy[s]) delete t;
+    }
+    for (auto d : wrapped) delete d;
+}
+
+void Prefetcher::stop() {
+    if (!running) return;
+
+    pthread_mutex_lock(&mtx);
+    halt = true;
+    pthread_cond_broadcast(&free_cv);
+    pthread_mutex_unlock(&mtx);
+
+    pthread_join(thr, nullptr);
+    running = false;
+}
+
+// Batch k of the stream (epochs one after the other)
+void Prefetcher::fill(long k) {
+    int b = k % num_batches;
+    if ((b == 0) && shuffle) std::shuffle(perm.begin(), perm.end(), rng);
+
+    vector<int> sind(perm.begin() + b * batch_size, perm.begin() + (b + 1) * batch_size);
+    int s = k % depth;
+
+    for (int i = 0; i < X.size(); i++) X[i]->select(sind, sx[s][i]);
+    for (int i = 0; i < Y.size(); i++) Y[i]->select(sind, sy[s][i]);
+
+    if (transform) transform(sx[s], sy[s]);
+}
+
+void *Prefetcher::worker_t(void *t) {
+    auto *p = (Prefetcher *) t;
+
+    while (true) {
+        pthread_mutex_lock(&p->mtx);
+        while (!p->halt && (p->produced - p->released >= p->depth))
+            pthread_cond_wait(&p->free_cv, &p->mtx);
+        if (p->halt) {
+            pthread_mutex_unlock(&p->mtx);
+            break;
+        }
+        long k = p->produced;
+        pthread_mutex_unlock(&p->mtx);
+
+        std::exception_ptr error = nullptr;
+        try {
+            p->fill(k);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        pthread_mutex_lock(&p->mtx);
+        if (error) p->error = error;
+        else p->produced++;
+        pthread_cond_signal(&p->ready_cv);
+        pthread_mutex_unlock(&p->mtx);
+
+        if (error) break;
+    }
+
+    return nullptr;
+}
+
+bool Prefetcher::next(vector<Tensor *> &bx, vector<Tensor *> &by) {
+    // Started on first use, so the transform can be set after construction
+    if (!running) {
+        int rc = pthread_create(&thr, nullptr, worker_t, (void *) this);
+        if (rc) throw std::runtime_error("unable to create thread " + std::to_string(rc));
+        running = true;
+    }
+
+    pthread_mutex_lock(&mtx);
+
+    // The previous batch is no longer used by the caller
+    if (released < consumed) {
+        released++;
+        pthread_cond_signal(&free_cv);
+    }
+
+    if (pos == num_batches) {
+        pos = 0;
+        pthread_mutex_unlock(&mtx);
+        return false;
+    }
+
+    if ((produced == consumed) && (error == nullptr)) {
+        high_resolution_clock::time_point t1 = high_resolution_clock::now();
+        while ((produced == consumed) && (error == nullptr))
+            pthread_cond_wait(&ready_cv, &mtx);
+        duration<double> span = high_resolution_clock::now() - t1;
+        stall_time += span.count();
+        stalls++;
+    }
+
+    if (error != nullptr) {
+        std::exception_ptr e = error;
+        pthread_mutex_unlock(&mtx);
+        std::rethrow_exception(e);
+    }
+
+    int s = consumed % depth;
+    consumed++;
+    pos++;
+    pthread_mutex_unlock(&mtx);
+
+    bx = sx[s];
+    by = sy[s];
+    return true;
+}
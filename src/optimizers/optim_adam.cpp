@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
 
 using namespace std;
 
@@ -23,6 +24,7 @@ Adam::Adam(float lr, float beta_1, float beta_2, float epsilon, float weight_dec
     this->epsilon = epsilon;
     this->weight_decay = weight_decay;
     this->amsgrad = amsgrad;
+    this->decoupled = false;
 
     t=0;
 
@@ -65,10 +67,18 @@ void Adam::setlayers(vlayer l) {
             mT.back()->fill_(0.0);
             vT.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
             vT.back()->fill_(0.0);
-            mCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
-            mCap.back()->fill_(0.0);
-            vCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
-            vCap.back()->fill_(0.0);
+
+            // The fused CPU kernel does not need scratch buffers
+            if (layers[i]->params[j]->isCPU()) {
+                mCap.push_back(nullptr);
+                vCap.push_back(nullptr);
+            }
+            else {
+                mCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
+                mCap.back()->fill_(0.0);
+                vCap.push_back(new Tensor(layers[i]->gradients[j]->getShape(), layers[i]->dev));
+                vCap.back()->fill_(0.0);
+            }
         }
 
 }
@@ -81,9 +91,26 @@ void Adam::applygrads(int batch) {
     clip();
     int p = 0;
     t++;
+
+    // Only AdamW decays the weights, Adam ignores weight_decay as it always did
+    float wd = (decoupled) ? weight_decay : 0.0f;
     for (int i = 0; i < layers.size(); i++)
       if (layers[i]->trainable) {
         for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+            vector<int> *rows = layers[i]->sparse_rows(j);
+            if (rows != nullptr) {
+                tensorNN::adam_rows(layers[i]->params[j], layers[i]->gradients[j], mT[p], vT[p], *rows,
+                                    lr, beta_1, beta_2, epsilon, wd, decoupled, t);
+                continue;
+            }
+            if (layers[i]->params[j]->isCPU()) {
+                tensorNN::adam(layers[i]->params[j], layers[i]->gradients[j], mT[p], vT[p],
+                               lr, beta_1, beta_2, epsilon, wd, decoupled, t);
+                continue;
+            }
+
+            if (wd != 0.0f) layers[i]->params[j]->mult_(1.0f - lr * wd);
+
             Tensor::add(beta_1,mT[p],(1-beta_1),layers[i]->gradients[j],mT[p],0);
             layers[i]->gradients[j]->sqr_();
             Tensor::add(beta_2,vT[p],(1-beta_2),layers[i]->gradients[j],vT[p],0);
@@ -100,8 +127,35 @@ void Adam::applygrads(int batch) {
 
             Tensor::add(-lr, mCap[p],1.0,layers[i]->params[j], layers[i]->params[j], 0);
         }
+        layers[i]->params_changed();
     }
     else p+=layers[i]->get_trainable_params_count();
   }
 
 }
+
+
+AdamW::AdamW(float lr, float beta_1, float beta_2, float epsilon, float weight_decay, bool amsgrad) :
+        Adam(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad) {
+    this->decoupled = true;
+}
+
+void AdamW::change(vector<float> &p) {
+  if (p.size()>0) lr = p[0];
+  if (p.size()>1) weight_decay = p[1];
+  cout<<"Optimizer AdamW set new lr="<<lr<<" weight_decay="<<weight_decay<<"\n";
+}
+
+Optimizer *AdamW::clone() {
+    AdamW *n=new AdamW(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad);
+    n->clip_val=clip_val;
+
+    return n;
+}
+Optimizer *AdamW::share() {
+    AdamW *n=new AdamW(lr, beta_1, beta_2, epsilon, weight_decay, amsgrad);
+    n->orig=this;
+    n->isshared=true;
+    n->clip_val=clip_val;
+    return n;
+}
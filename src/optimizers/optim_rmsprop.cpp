@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
 
 using namespace std;
 
@@ -75,6 +76,11 @@ void RMSProp::applygrads(int batch) {
     for (int i = 0; i < layers.size(); i++)
       if (layers[i]->trainable) {
         for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+            vector<int> *rows = layers[i]->sparse_rows(j);
+            if (rows != nullptr) {
+              tensorNN::rmsprop_rows(layers[i]->params[j], layers[i]->gradients[j], gT1[p], *rows, lr, rho, epsilon);
+              continue;
+            }
             Tensor::copy(layers[i]->gradients[j],gT[p]);
             gT[p]->sqr_();
             gT[p]->mult_(1.0f-rho);
@@ -96,6 +102,7 @@ void RMSProp::applygrads(int batch) {
       			}
             */
         }
+        layers[i]->params_changed();
     }
     else p+=layers[i]->get_trainable_params_count();
   }
@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "eddl/optimizers/optim.h"
+#include "eddl/tensor/nn/tensor_nn.h"
 
 using namespace std;
 
@@ -73,9 +74,15 @@ void SGD::applygrads(int batch) {
       for (int i = 0; i < layers.size(); i++) {
         if (layers[i]->trainable) {
           for (int j = 0; j < layers[i]->get_trainable_params_count(); j++, p++) {
+            vector<int> *rows = layers[i]->sparse_rows(j);
+            if (rows != nullptr) {
+              tensorNN::sgd_rows(layers[i]->params[j], layers[i]->gradients[j], mT[p], *rows, lr, mu);
+              continue;
+            }
             Tensor::add(lr , layers[i]->gradients[j], mu, mT[p], mT[p], 0);
             Tensor::add(1.0, layers[i]->params[j], -1.0, mT[p], layers[i]->params[j], 0);
           }
+          layers[i]->params_changed();
         }
         else p+=layers[i]->get_trainable_params_count();
       }
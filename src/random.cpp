@@ -9,6 +9,7 @@
 #include <cstdio>
 #include <cmath>
 #include <random>
+#include <atomic>
 
 #include "eddl/random.h"
 #include "eddl/utils.h"
@@ -19,16 +20,46 @@
 static float *RTable=nullptr;
 static int posTable=0;
 
-// Default seed
-static std::random_device rd;  //Will be used to obtain a seed for the random number engine
-static std::mt19937 gen(rd()); //Standard mersenne_twister_engine seeded with rd()
+// Default seed (non-deterministic until set_random_seed is called)
+static std::random_device rd;
+static std::atomic<uint64_t> rng_seed(((uint64_t)rd() << 32) | rd());  // read by the workers
+static std::atomic<uint64_t> rng_counter(0);
+static std::atomic<uint64_t> rng_epoch(0);  // Changes with the seed: drops the blocks of uniform()
 
+#define UNIFORM_BLOCK 64  // Counters reserved at once by uniform() (4 values each)
+
+
+void set_random_seed(uint64_t seed) {
+    rng_seed = seed;
+    rng_counter = 0;
+    rng_epoch++;
+}
+
+uint64_t get_random_seed() {
+    return rng_seed;
+}
+
+uint64_t reserve_random_counters(uint64_t n) {
+    return rng_counter.fetch_add(n);
+}
 
 float uniform(float min, float max) {
-    // rand() may not generate numbers uniformly and is therefore discouraged
-    // Talk: https://channel9.msdn.com/Events/GoingNative/2013/rand-Considered-Harmful
-    std::uniform_real_distribution<float> distr(min, max);
-    return distr(gen);
+    // Thread-safe: every thread draws from its own block of counters
+    thread_local uint64_t epoch = ~(uint64_t)0, next = 0, end = 0;
+    thread_local uint32_t r[4];
+    thread_local int k = 4;
+
+    uint64_t e = rng_epoch.load(std::memory_order_relaxed);
+    if (epoch != e) { epoch = e; next = end = 0; k = 4; }
+    if (k == 4) {
+        if (next == end) {
+            next = reserve_random_counters(UNIFORM_BLOCK);
+            end = next + UNIFORM_BLOCK;
+        }
+        philox4x32(next++, rng_seed.load(std::memory_order_relaxed), r);
+        k = 0;
+    }
+    return min + (max - min) * philox_uniform(r[k++]);
 }
 
 float signed_uniform() {
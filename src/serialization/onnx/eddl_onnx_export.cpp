@@ -1,6 +1,7 @@
 #include <cstdio>
 #include <fstream>
 #include "eddl/serialization/onnx/eddl_onnx.h"
+#include "eddl/hardware/cpu/cpu_half.h"
 
 using namespace std;
 
@@ -13,6 +14,9 @@ using namespace std;
 #if defined(cPROTO)
 	onnx::ModelProto build_onnx_model(Net *net, bool gradients );
 
+	// Stores the float initializers of the graph with 16 bits
+	void set_initializers_dtype( onnx::GraphProto *graph, int dtype );
+
 	// Builds the graph of the ModelProto from the net
 	void set_graph( onnx::ModelProto *model, Net *net, bool gradients );
 
@@ -24,6 +28,8 @@ using namespace std;
 
 	void build_conv_node( LConv *layer, onnx::GraphProto *graph, bool gradients );
 
+	void build_convT_node( LConvT *layer, onnx::GraphProto *graph );
+
 	void build_gemm_node( LDense *layer, onnx::GraphProto *graph, bool gradients );
 
 	void build_maxpool_node( LMaxPool *layer, onnx::GraphProto *graph );
@@ -83,12 +89,18 @@ using namespace std;
 
 #ifdef cPROTO
 
-	void save_net_to_onnx_file( Net *net, string path ) {
+	void save_net_to_onnx_file( Net *net, string path, const string& dtype ) {
+		// bfloat16 tensors and their Cast need opset 13, the nodes are written for opset 11
+		int weights_dtype = get_dtype( dtype );
+		if ( weights_dtype != DTYPE_FLOAT32 && weights_dtype != DTYPE_FLOAT16 )
+			msg( "Only float32 and float16 weights can be exported (opset 11)", "save_net_to_onnx_file" );
 		// Builds all the model in onnx from the Net object
 		if (net->snets[0]->dev!=DEV_CPU)
 			net->sync_weights();
 		bool export_gradients = false; // We always store weights to file
 		onnx::ModelProto model = build_onnx_model( net , export_gradients );
+		if ( weights_dtype != DTYPE_FLOAT32 )
+			set_initializers_dtype( model.mutable_graph(), weights_dtype );
 		// Create the file stream and save the serialization of the onnx model in it
 		fstream ofs( path, ios::out | ios::binary );
     	if ( !model.SerializeToOstream( &ofs ) ) { // The serialization is automated by the protobuf library
@@ -125,6 +137,9 @@ using namespace std;
 	}
 	
 	onnx::ModelProto build_onnx_model( Net *net , bool gradients ) {
+		// The nodes do not describe folded BatchNorm, fused activations or quantized weights
+		if ( net->isinference )
+			msg( "Net optimized for inference, export it before optimize_inference, quantize or plan_memory", "build_onnx_model" );
 		string producer_name ( "EDDL" ); 
 		string producer_version ( "0.1" ); // ????????????????
 		// Create the empty Model in onnx
@@ -140,6 +155,40 @@ using namespace std;
 		return model;
 	}
 
+	// Each float initializer "x" is stored as "x_half" and a Cast node at the
+	// beginning of the graph gives back "x" in float, so the nodes are unchanged
+	void set_initializers_dtype( onnx::GraphProto *graph, int dtype ) {
+		google::protobuf::RepeatedPtrField<onnx::NodeProto> nodes;
+		for ( int i = 0; i < graph->initializer_size(); i++ ) {
+			onnx::TensorProto* init = graph->mutable_initializer( i );
+			if ( init->data_type() != onnx::TensorProto::FLOAT ) continue;
+
+			vector<float> values( init->float_data().begin(), init->float_data().end() );
+			vector<uint16_t> bits( values.size() );
+			cpu_float_to_half( values.data(), bits.data(), values.size(), dtype );
+
+			string name = init->name();
+			init->set_name( name + "_half" );
+			init->set_data_type( onnx::TensorProto::FLOAT16 );
+			init->clear_float_data();
+			init->set_raw_data( bits.data(), bits.size() * sizeof(uint16_t) );
+
+			onnx::NodeProto* node = nodes.Add();
+			node->set_op_type( "Cast" );
+			node->set_name( name + "_cast" );
+			node->add_input( name + "_half" );
+			node->add_output( name );
+			onnx::AttributeProto* to_attr = node->add_attribute();
+			to_attr->set_name( "to" );
+			to_attr->set_type( onnx::AttributeProto::INT );
+			to_attr->set_i( onnx::TensorProto::FLOAT );
+		}
+
+		for ( int i = 0; i < graph->node_size(); i++ )
+			*nodes.Add() = graph->node( i );
+		graph->mutable_node()->Swap( &nodes );
+	}
+
 	void set_graph( onnx::ModelProto *model, Net *net, bool gradients ) {
 		// Add a new empty graph to the model
 		onnx::GraphProto* graph = model->mutable_graph();
@@ -194,6 +243,10 @@ using namespace std;
 		else if ( LConv* t = dynamic_cast<LConv*>( layer ) ) 
 		{
 	    	build_conv_node( (LConv*)(LinLayer*)layer, graph, gradients );
+	    } 
+		else if ( LConvT* t = dynamic_cast<LConvT*>( layer ) ) 
+		{
+	    	build_convT_node( (LConvT*)(LinLayer*)layer, graph );
 	    } 
 		else if ( LDense *t = dynamic_cast<LDense*>( layer ) ) 
 		{
@@ -347,15 +400,13 @@ using namespace std;
 		onnx::AttributeProto* conv_dilations = node->add_attribute();
 		conv_dilations->set_name( "dilations" );
 		conv_dilations->set_type( onnx::AttributeProto::INTS );
-		vector<int> vdilations {1, 1}; // ?? Tenemos esto en EDDL
-		for ( int i : vdilations ) {
-			conv_dilations->add_ints( i );
-		}
+		conv_dilations->add_ints( layer->cd->dr );
+		conv_dilations->add_ints( layer->cd->dc );
 		//Attr group
 		onnx::AttributeProto* conv_group = node->add_attribute();
 		conv_group->set_name( "group" );
 		conv_group->set_type( onnx::AttributeProto::INT );
-		conv_group->set_i( 1 ); // ????????????????????????????????????????????????????
+		conv_group->set_i( layer->cd->groups );
 		// Attr kernel_shape
 		onnx::AttributeProto* conv_kernel_shape = node->add_attribute();
 		conv_kernel_shape->set_name( "kernel_shape" );
@@ -411,6 +462,72 @@ using namespace std;
 		}
 	}
 	
+	void build_convT_node( LConvT *layer, onnx::GraphProto *graph ) {
+		// Add an empty node to the graph
+		onnx::NodeProto* node = graph->add_node();
+		node->set_op_type( "ConvTranspose" );
+		node->set_name( layer->name );
+		// Set the inputs of the node from the parents of the layer
+		for ( Layer* parentl : layer->parent ) {
+			node->add_input( parentl->name );
+		}
+		// Set the input params names of the conv op
+		node->add_input( layer->name + "_W" );
+		if ( layer->use_bias ) node->add_input( layer->name + "_b" );
+		// Set the name of the output of the node to link with other nodes
+		node->add_output( layer->name );
+
+		////////////////////////// Attributes of the ConvTranspose operation //////////////////////////////////
+		// cd is the convolution from the output to the input: same attributes
+		// Attr dilations
+		onnx::AttributeProto* convt_dilations = node->add_attribute();
+		convt_dilations->set_name( "dilations" );
+		convt_dilations->set_type( onnx::AttributeProto::INTS );
+		convt_dilations->add_ints( layer->cd->dr );
+		convt_dilations->add_ints( layer->cd->dc );
+		// Attr kernel_shape
+		onnx::AttributeProto* convt_kernel_shape = node->add_attribute();
+		convt_kernel_shape->set_name( "kernel_shape" );
+		convt_kernel_shape->set_type( onnx::AttributeProto::INTS );
+		convt_kernel_shape->add_ints( layer->cd->kr );
+		convt_kernel_shape->add_ints( layer->cd->kc );
+		// Attr output_padding
+		onnx::AttributeProto* convt_output_padding = node->add_attribute();
+		convt_output_padding->set_name( "output_padding" );
+		convt_output_padding->set_type( onnx::AttributeProto::INTS );
+		convt_output_padding->add_ints( layer->output_padding[0] );
+		convt_output_padding->add_ints( layer->output_padding[1] );
+		// Attr pads
+		onnx::AttributeProto* convt_pads = node->add_attribute();
+		convt_pads->set_name( "pads" );
+		convt_pads->set_type( onnx::AttributeProto::INTS );
+		convt_pads->add_ints( layer->cd->padrt );
+		convt_pads->add_ints( layer->cd->padcl );
+		convt_pads->add_ints( layer->cd->padrb );
+		convt_pads->add_ints( layer->cd->padcr );
+		// Attr strides
+		onnx::AttributeProto* convt_strides = node->add_attribute();
+		convt_strides->set_name( "strides" );
+		convt_strides->set_type( onnx::AttributeProto::INTS );
+		convt_strides->add_ints( layer->cd->sr );
+		convt_strides->add_ints( layer->cd->sc );
+
+		// Weights input, {in, out, kr, kc} as in ONNX
+		onnx::TensorProto* convt_w = graph->add_initializer();
+		convt_w->set_name( layer->name + "_W" );
+		convt_w->set_data_type( onnx::TensorProto::FLOAT );
+		convt_w->mutable_dims()->Add( layer->cd->K->shape.begin(), layer->cd->K->shape.end() );
+		convt_w->mutable_float_data()->Add( layer->cd->K->ptr, layer->cd->K->ptr + layer->cd->K->size );
+		// Bias input
+		if ( layer->use_bias ) {
+			onnx::TensorProto* convt_b = graph->add_initializer();
+			convt_b->set_name( layer->name + "_b" );
+			convt_b->set_data_type( onnx::TensorProto::FLOAT );
+			convt_b->mutable_dims()->Add( layer->cd->bias->shape.begin(), layer->cd->bias->shape.end() );
+			convt_b->mutable_float_data()->Add( layer->cd->bias->ptr, layer->cd->bias->ptr + layer->cd->bias->size );
+		}
+	}
+
 	void build_gemm_node( LDense *layer, onnx::GraphProto *graph, bool gradients) {
 		// Add an empty node to the graph
 		onnx::NodeProto* node = graph->add_node();
@@ -1044,7 +1161,7 @@ using namespace std;
 	// End: Exporting Module
 	//----------------------------------------------------------------------------------------
 #else
-	void save_net_to_onnx_file( Net *net, string path ){
+	void save_net_to_onnx_file( Net *net, string path, const string& dtype ){
 		cerr << "Not compiled for ONNX. Missing Protobuf" << endl;
 	}
 
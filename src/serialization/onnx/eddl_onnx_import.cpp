@@ -5,11 +5,12 @@
 #include "eddl/layers/conv/layer_conv.h"
 #include "eddl/layers/normalization/layer_normalization.h"
 #include "eddl/layers/pool/layer_pool.h"
+#include "eddl/hardware/cpu/cpu_half.h"
 #include <map>
 #include <set>
 #include <algorithm>
 
-#define NEW_FROM_VECTOR_PTR(v) (copy((v)->begin(), (v)->end(), new float[(v)->size()]) - (v)->size())
+#define NEW_FROM_VECTOR_PTR(v) (copy((v)->begin(), (v)->end(), get_fmem((v)->size(), "ONNX import")) - (v)->size())
 std::vector<int> vf2vi(const std::vector<float>& vf)
 {
     std::vector<int> vi;
@@ -46,7 +47,7 @@ using namespace std;
 		RESHAPE,            // implemented
 		FLATTEN,            // implemented
 		TRANSPOSE,          // implementing
-		TRANSPOSED_CONV,	// not implemented in eddl
+		TRANSPOSED_CONV,	// implemented
 		UPSAMPLING,         // deprecated in ONNX, but works for EDDL
 		MAXPOOL,			// implemented
 		AVGPOOL,            // needs testing
@@ -203,6 +204,22 @@ using namespace std;
 		return true;
 	}
 
+	//16-bit floats are stored as their bits, in raw_data or one per int32_data
+	vector<float> parseHalfValues(onnx::TensorProto t, int dtype){
+		vector<uint16_t> bits;
+		if(t.has_raw_data()){
+			TryConvertingTensorRawValues(t, bits);
+		}
+		else{
+			for(int i = 0; i < t.int32_data_size(); i++){
+				bits.push_back((uint16_t)t.int32_data(i));
+			}
+		}
+		vector<float> values(bits.size());
+		cpu_half_to_float(bits.data(), values.data(), bits.size(), dtype);
+		return values;
+	}
+
 	//Parses the values of the onnx tensor to a c++ vector of that type
 	vector<float> parseTensorValues(onnx::TensorProto t){
 		int data_type = t.data_type(); //Only works for non raw data for now
@@ -263,6 +280,7 @@ using namespace std;
 				}
 				break;
 			case onnx::TensorProto::FLOAT16:
+				values = parseHalfValues(t, DTYPE_FLOAT16);
 				break;
 			case onnx::TensorProto::DOUBLE:
 				for(int i = 0; i < t.double_data_size(); i++){
@@ -286,7 +304,7 @@ using namespace std;
 				//TODO: Make this
 				break;
 			case onnx::TensorProto::BFLOAT16:
-				//TODO: Make this
+				values = parseHalfValues(t, DTYPE_BFLOAT16);
 				break;
 
 			default:
@@ -403,6 +421,22 @@ using namespace std;
 		return nodes;
 	}
 
+	//Cast nodes of initializers (e.g. 16-bit weights cast to float) are removed,
+	//their outputs take the already converted values of the initializer
+	void fold_initializer_casts(vector<onnx::NodeProto> &nodes, map<string, vector<float> > &values_map, map<string, vector<int> > &dims_map) {
+		vector<onnx::NodeProto> kept;
+		for(onnx::NodeProto &node : nodes) {
+			if(node.op_type() == "Cast" && node.input_size() == 1 && values_map.count(node.input(0))) {
+				values_map[node.output(0)] = values_map[node.input(0)];
+				dims_map[node.output(0)] = dims_map[node.input(0)];
+			}
+			else {
+				kept.push_back(node);
+			}
+		}
+		nodes = kept;
+	}
+
 
 	//Imports a net stored in a onnx file
 	Net* import_net_from_onnx_file(std::string path, int mem) {
@@ -492,6 +526,7 @@ using namespace std;
 																			//  Key: Input Name . Value: Weights
 																			//  Key: Input Name . Value: Dims
 		vector<onnx::NodeProto> nodes = get_graph_nodes(graph);
+		fold_initializer_casts(nodes, map_init_values, map_init_dims);
 		//The methodology is the following:
 		//We create three maps:
 		//map <string input, vector<onnx::NodeProto *> > input_node_map. The input will point towards the nodes that have this input
@@ -665,6 +700,8 @@ using namespace std;
 						vector<int> kernel_shape;
 						vector<int> strides;
 						vector<int> pads;
+						vector<int> dilations = {1, 1};
+						int group = 1;
 						//bool explicit_padding;
 						string auto_pad_option = "";
 						bool auto_pad = false;
@@ -684,11 +721,14 @@ using namespace std;
 								else if(!attribute.s().compare("SAME_UPPER"))
 									auto_pad_option = "same";
 							}
-							else if (!attr_name.compare("dilations")) { //It isn't implemented in eddl
-
+							else if (!attr_name.compare("dilations")) {
+								dilations.clear();
+								for(int h = 0; h < attribute.ints_size(); h++){
+									dilations.push_back(attribute.ints(h));
+								}
 							}
-							else if (!attr_name.compare("group")) { //We don't know if this exists in eddl
-
+							else if (!attr_name.compare("group")) {
+								group = attribute.i();
 							}
 							else if (!attr_name.compare("kernel_shape")) { //
 								for( int h = 0; h<attribute.ints_size(); h++){
@@ -730,9 +770,11 @@ using namespace std;
 						ConvolDescriptor* convol_descriptor;
 						if(!auto_pad){
 							kernel_shape.insert(kernel_shape.begin(), filters); //Add number of filters to kernel shape
-							convol_descriptor = new ConvolDescriptor(kernel_shape, strides, pads);
+							pads = {pads[0], pads[2], pads[1], pads[3]}; // ONNX: {top, left, bottom, right}
+							convol_descriptor = new ConvolDescriptor(kernel_shape, strides, pads, mem, group, dilations);
+							convol_descriptor->use_bias = node->input_size() > 2;
 						}
-						else convol_descriptor = new ConvolDescriptor(filters, kernel_shape, strides, auto_pad_option, node->input_size() > 2, mem);
+						else convol_descriptor = new ConvolDescriptor(filters, kernel_shape, strides, auto_pad_option, node->input_size() > 2, mem, group, dilations);
 
 						actual_layer = new LConv(parent, convol_descriptor, name, dev, mem);
 
@@ -752,6 +794,103 @@ using namespace std;
 						break;
 					}
 
+				case ONNX_LAYERS::TRANSPOSED_CONV:
+					{
+						vector<int> kernel_shape;
+						vector<int> strides = {1, 1};
+						vector<int> pads = {0, 0, 0, 0};
+						vector<int> dilations = {1, 1};
+						vector<int> output_padding = {0, 0};
+						int group = 1;
+						string auto_pad_option = "";
+						bool auto_pad = false;
+
+						for ( int j = 0; j < node->attribute_size(); j++ ) { //Set the attributes
+							onnx::AttributeProto attribute = node->attribute(j);
+							string attr_name = attribute.name();
+							if (!attr_name.compare("auto_pad")) {
+								auto_pad = true;
+								if(!attribute.s().compare("NOTSET")){
+									auto_pad = false;
+									continue;
+								}
+								else if(!attribute.s().compare("VALID"))
+									auto_pad_option = "none";
+								else if(!attribute.s().compare("SAME_UPPER"))
+									auto_pad_option = "same";
+							}
+							else if (!attr_name.compare("dilations")) {
+								dilations.clear();
+								for(int h = 0; h < attribute.ints_size(); h++){
+									dilations.push_back(attribute.ints(h));
+								}
+							}
+							else if (!attr_name.compare("group")) {
+								group = attribute.i();
+							}
+							else if (!attr_name.compare("kernel_shape")) {
+								for( int h = 0; h<attribute.ints_size(); h++){
+									kernel_shape.push_back(attribute.ints(h));
+								}
+							}
+							else if (!attr_name.compare("output_padding")) {
+								output_padding.clear();
+								for(int h = 0; h < attribute.ints_size(); h++){
+									output_padding.push_back(attribute.ints(h));
+								}
+							}
+							else if (!attr_name.compare("output_shape")) {
+								msg("ConvTranspose with output_shape is not supported, use pads and output_padding", "ONNX::ImportNet");
+							}
+							else if (!attr_name.compare("pads")) {
+								for(int h = 0; h < 4; h++){
+									pads[h] = attribute.ints(h);
+								}
+							}
+							else if (!attr_name.compare("strides")) {
+								strides.clear();
+								for(int h = 0; h < attribute.ints_size(); h++){
+									strides.push_back(attribute.ints(h));
+								}
+							}
+						}
+						if (group != 1) msg("Grouped ConvTranspose is not supported", "ONNX::ImportNet");
+
+						string parent_name = node->input(0); //Get parent
+						Layer* parent = output_node_map[parent_name];
+
+						string weights_name = node->input(1); //Get weights and dims, {in, out, kr, kc}
+						vector<float>* weights = &(map_init_values[weights_name]);
+						vector<int> dims = map_init_dims[weights_name];
+						if (kernel_shape.empty()) kernel_shape = {dims[2], dims[3]};
+
+						int filters = dims[1];
+						bool use_bias = node->input_size() > 2;
+						string name = node->name();
+						LConvT* convt;
+						if(!auto_pad){
+							pads = {pads[0], pads[2], pads[1], pads[3]}; // ONNX: {top, left, bottom, right}
+							ConvolDescriptor* convol_descriptor = new ConvolDescriptor({dims[0], kernel_shape[0], kernel_shape[1]}, strides, pads, mem, 1, dilations);
+							convt = new LConvT(parent, convol_descriptor, filters, output_padding, use_bias, name, dev, mem);
+						}
+						else convt = new LConvT(parent, filters, kernel_shape, output_padding, auto_pad_option, dilations, strides, use_bias, name, dev, mem);
+						actual_layer = convt;
+
+						if(use_bias){
+							string bias_name = node->input(2);
+							vector<float> *bias = &(map_init_values[bias_name]);
+							vector<int> bias_shape;
+							bias_shape.push_back(bias->size());
+							Tensor* bias_tensor = new Tensor(bias_shape, NEW_FROM_VECTOR_PTR(bias), dev);
+							Tensor::copy(bias_tensor , convt->cd->bias);
+							delete bias_tensor;
+						}
+						Tensor* weights_tensor = new Tensor(dims, NEW_FROM_VECTOR_PTR(weights), dev);
+						Tensor::copy(weights_tensor, convt->cd->K);
+						delete weights_tensor;
+						break;
+					}
+
 				case ONNX_LAYERS::DENSE:
 					{
 						int ndim;
@@ -1509,6 +1648,7 @@ using namespace std;
 
 		map<string, vector<Tensor*> > tensors = get_tensors_from_onnx(model);
 		LConv* conv;
+		LConvT* convt;
 		LDense* dense;
 		for(Layer* l : net->layers){
 			if(!tensors.count(l->name)){
@@ -1525,6 +1665,12 @@ using namespace std;
 				}
 
 			}
+			else if((convt = dynamic_cast<LConvT*>(l))){
+				if(layer_tensors.size() > 1)
+					convt->update_weights(layer_tensors[0], layer_tensors[1]);
+				else
+					convt->update_weights(layer_tensors[0]);
+			}
 			else if((dense = dynamic_cast<LDense*>( l ) )){
 				if(layer_tensors.size() > 1)
 					dense->update_weights(layer_tensors[0], layer_tensors[1]);
@@ -1556,6 +1702,7 @@ using namespace std;
 
 		map<string, vector<Tensor*> > tensors = get_tensors_from_onnx(model);
 		LConv* conv;
+		LConvT* convt;
 		LDense* dense;
 		for(Layer* l : net->layers){
 			if(!tensors.count(l->name)){
@@ -1572,6 +1719,12 @@ using namespace std;
 				}
 
 			}
+			else if((convt = dynamic_cast<LConvT*>(l))){
+				if(layer_tensors.size() > 1)
+					convt->update_weights(layer_tensors[0], layer_tensors[1]);
+				else
+					convt->update_weights(layer_tensors[0]);
+			}
 			else if((dense = dynamic_cast<LDense*>( l ) )){
 				if(layer_tensors.size() > 1)
 					dense->update_weights(layer_tensors[0], layer_tensors[1]);
@@ -1704,6 +1857,7 @@ using namespace std;
 																			//  Key: Input Name . Value: Weights
 																			//  Key: Input Name . Value: Dims
 		vector<onnx::NodeProto> nodes = get_graph_nodes(graph);
+		fold_initializer_casts(nodes, map_init_values, map_init_dims);
 
 		map<string, ONNX_LAYERS> map_layers = create_enum_map();
 		int dev = DEV_CPU;//TODO: Check what device to use
@@ -1715,6 +1869,7 @@ using namespace std;
 
 			switch (layer_type) {
 				case ONNX_LAYERS::CONV:
+				case ONNX_LAYERS::TRANSPOSED_CONV:
 					{
 
 						vector<Tensor*> conv_tensors;
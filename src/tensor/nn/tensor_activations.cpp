@@ -72,6 +72,21 @@ namespace tensorNN {
         PD->tsem->unlock();
     }
 
+// Bias + activation (fused layer outputs)
+    void BiasActivation(Tensor *A, Tensor *bias, int act) {
+        if ((bias != nullptr) && (A->device != bias->device)) msg("Tensors in different devices", "Tensor::BiasActivation");
+        if ((bias != nullptr) && (bias->size != A->shape[1])) msg("Incompatible dims", "Tensor::BiasActivation");
+
+        A->tsem->lock();
+        if (A->isCPU()) {
+            cpu_bias_act(A, bias, act);
+        }
+        else {
+            msg("Only implemented for CPU", "Tensor::BiasActivation");
+        }
+        A->tsem->unlock();
+    }
+
 // ThresholdedReLu
     void ThresholdedReLu(Tensor *A, Tensor *B, float param) {
         if (A->device != B->device) msg("Tensors in different devices", "Tensor::ThresholdedReLu");
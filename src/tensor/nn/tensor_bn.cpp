@@ -92,4 +92,29 @@ namespace tensorNN {
 #endif
     }
 
-}
\ No newline at end of file
+
+// Batchnorm without permutes: input/output/opa are {B,C} or {B,C,H,W}, the rest {C}.
+// gamma/beta (and their gradients) are nullptr when there is no affine transform (CPU)
+    void BatchNormForward(Tensor *input, Tensor *output, Tensor *opa, Tensor *mean, Tensor *variance,
+                          Tensor *bn_g, Tensor *bn_b, Tensor *bn_mean, Tensor *bn_var,
+                          float momentum, float epsilon, int trmode) {
+        if (!input->isCPU()) msg("Only implemented for CPU", "Tensor::BatchNormForward");
+        if ((!Tensor::sameShape(input, output)) || (input->size != opa->size)) msg("Incompatible dims", "Tensor::BatchNormForward");
+        if (mean->size != input->shape[1]) msg("Incompatible dims", "Tensor::BatchNormForward");
+
+        output->tsem->lock();
+        cpu_batchnorm_forward(input, output, opa, mean, variance, bn_g, bn_b, bn_mean, bn_var, momentum, epsilon, trmode);
+        output->tsem->unlock();
+    }
+
+    void BatchNormBackward(Tensor *delta, Tensor *opa, Tensor *pdelta, Tensor *gbn_g, Tensor *gbn_b,
+                           Tensor *bn_g, Tensor *bn_var) {
+        if (!delta->isCPU()) msg("Only implemented for CPU", "Tensor::BatchNormBackward");
+        if ((!Tensor::sameShape(delta, pdelta)) || (delta->size != opa->size)) msg("Incompatible dims", "Tensor::BatchNormBackward");
+
+        pdelta->tsem->lock();
+        cpu_batchnorm_backward(delta, opa, pdelta, gbn_g, gbn_b, bn_g, bn_var);
+        pdelta->tsem->unlock();
+    }
+
+}
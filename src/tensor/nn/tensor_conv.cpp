@@ -35,7 +35,8 @@ void Conv2D(ConvolDescriptor *D) {
 
     D->O->tsem->lock();
     if (D->I->isCPU()) {
-        cpu_conv2D(D);
+        if (D->qd != nullptr) cpu_qconv2D(D);
+        else cpu_conv2D(D);
     }
 #ifdef cGPU
     else if (D->I->isGPU())
@@ -106,4 +107,55 @@ void Conv2D_back(ConvolDescriptor *D) {
     D->ID->tsem->unlock();
 }
 
-}
\ No newline at end of file
+void Conv2DT(ConvolDescriptor *D, Tensor *bias) {
+    /////////////////////////////////////////////////////////////////////
+    //// Conv2DT (transposed convolution)
+    //// D is the convolution from the output (D->ID) to the input (D->D)
+    /////////////////////////////////////////////////////////////////////
+    if ((D->D->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2DT");
+
+    D->ID->tsem->lock();
+    if (D->D->isCPU()) {
+        cpu_conv2DT(D, bias);
+    }
+    else {
+        msg("Transposed convolutions are only implemented for CPU", "Tensor::Conv2DT");
+    }
+    D->ID->tsem->unlock();
+}
+
+void Conv2DT_grad(ConvolDescriptor *D, Tensor *gbias) {
+    /////////////////////////////////////////////////////////////////////
+    //// Conv2DT Grad
+    //// D->I is the delta of the output, D->D the input
+    /////////////////////////////////////////////////////////////////////
+    if ((D->I->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2DT_grad");
+
+    D->gK->tsem->lock();
+    if (D->I->isCPU()) {
+        cpu_conv2DT_grad(D, gbias);
+    }
+    else {
+        msg("Transposed convolutions are only implemented for CPU", "Tensor::Conv2DT_grad");
+    }
+    D->gK->tsem->unlock();
+}
+
+void Conv2DT_back(ConvolDescriptor *D, Tensor *PD) {
+    /////////////////////////////////////////////////////////////////////
+    //// Conv2DT Back
+    //// D->I is the delta of the output, PD the delta of the input
+    /////////////////////////////////////////////////////////////////////
+    if ((D->I->ndim != 4)) msg("Tensors are not 4D", "Tensor::Conv2DT_back");
+
+    PD->tsem->lock();
+    if (D->I->isCPU()) {
+        cpu_conv2DT_back(D, PD);
+    }
+    else {
+        msg("Transposed convolutions are only implemented for CPU", "Tensor::Conv2DT_back");
+    }
+    PD->tsem->unlock();
+}
+
+}
@@ -10,6 +10,7 @@
 #include <float.h>
 
 #include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/cpu_tensor.h"
 #include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
 
 #ifdef cGPU
@@ -76,9 +77,23 @@ namespace tensorNN {
     }
 
 
+    // Per-sample permutation dims with the batch kept first (and its inverse)
+    static vector<int> permute_batch_dims(PermuteDescriptor *pd, bool inverse){
+        vector<int> dims={0};
+        for(auto d : pd->dims) dims.push_back(d+1);
+        if (!inverse) return dims;
+
+        vector<int> inv(dims.size());
+        for(int i=0;i<dims.size();i++) inv[dims[i]]=i;
+        return inv;
+    }
+
     void select(Tensor *A, Tensor* B, SelDescriptor *sd){
         if (A->isCPU() && B->isCPU()) {
-            cpu_select_nn(A, B, sd);
+            // Permutations go through the strided kernel (no address table)
+            auto *pd = dynamic_cast<PermuteDescriptor *>(sd);
+            if (pd != nullptr) cpu_permute(A, B, permute_batch_dims(pd, false), 0);
+            else cpu_select_nn(A, B, sd);
         }
 #ifdef cGPU
         else if (A->isGPU() && B->isGPU())
@@ -97,7 +112,9 @@ namespace tensorNN {
 
     void select_back(Tensor *A, Tensor* B, SelDescriptor *sd){
         if (A->isCPU() && B->isCPU()) {
-            cpu_select_back_nn(A, B, sd);
+            auto *pd = dynamic_cast<PermuteDescriptor *>(sd);
+            if (pd != nullptr) cpu_permute(A, B, permute_batch_dims(pd, true), 1);
+            else cpu_select_back_nn(A, B, sd);
         }
 #ifdef cGPU
         else if (A->isGPU() && B->isGPU())
@@ -47,4 +47,28 @@ namespace tensorNN {
         C->tsem->unlock();
     }
 
+
+// Softmax + Cross-Entropy: D=(Y-T)/batch, returns sum(cent(T,Y)) in the same pass (CPU)
+    float soft_cent(Tensor *T, Tensor *Y, Tensor *D) {
+        if ((T->device != Y->device) || (T->device != D->device)) msg("Tensors in different devices", "Tensor::soft_cent");
+        if ((!Tensor::sameShape(T, Y)) || (!Tensor::sameShape(T, D))) msg("Incompatible dims", "Tensor::soft_cent");
+
+        float f;
+        if (T->isCPU()) {
+            D->tsem->lock();
+            f = cpu_soft_cent(T, Y, D);
+            D->tsem->unlock();
+        }
+        else {
+            Tensor *aux = new Tensor(T->getShape(), T->device);
+            cent(T, Y, aux);
+            f = aux->sum();
+            delete aux;
+
+            Tensor::add(-1.0, T, 1.0, Y, D, 0);
+            D->div_(D->shape[0]);
+        }
+        return f;
+    }
+
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+namespace tensorNN {
+
+// Fused LSTM kernels. Gates are packed as [i | f | o | c] (only CPU, other
+// devices use the per-gate implementation of LLSTM)
+
+// P = [W_0 | W_1 | ... ]
+    void lstm_pack(vector<Tensor *> W, Tensor *P) {
+        if (!P->isCPU()) msg("Only implemented for CPU", "Tensor::lstm_pack");
+        for (auto w : W)
+            if (w->size * W.size() != P->size) msg("Incompatible dims", "Tensor::lstm_pack");
+
+        P->tsem->lock();
+        cpu_lstm_pack(W, P);
+        P->tsem->unlock();
+    }
+
+// G (gate pre-activations) --> G (gate activations), H, C and SH=tanh(C)
+// If X is given, rows of X with only zeros keep the previous state
+    void lstm_cell(Tensor *G, Tensor *bias, Tensor *X, Tensor *prev_h, Tensor *prev_c, Tensor *H, Tensor *C, Tensor *SH) {
+        if (!G->isCPU()) msg("Only implemented for CPU", "Tensor::lstm_cell");
+        if ((!Tensor::sameShape(H, C)) || (!Tensor::sameShape(H, SH))) msg("Incompatible dims", "Tensor::lstm_cell");
+        if ((G->shape[0] != H->shape[0]) || (G->shape[1] != 4 * H->shape[1]) || (bias->size != G->shape[1]))
+            msg("Incompatible dims", "Tensor::lstm_cell");
+
+        H->tsem->lock();
+        cpu_lstm_cell(G, bias, X, prev_h, prev_c, H, C, SH);
+        H->tsem->unlock();
+    }
+
+// G (gate activations) --> G (gate deltas). Deltas of the previous state are incremented
+    void d_lstm_cell(Tensor *G, Tensor *SH, Tensor *X, Tensor *prev_c, Tensor *DH, Tensor *DC, Tensor *prev_dh, Tensor *prev_dc) {
+        if (!G->isCPU()) msg("Only implemented for CPU", "Tensor::d_lstm_cell");
+        if ((!Tensor::sameShape(DH, DC)) || (!Tensor::sameShape(DH, SH))) msg("Incompatible dims", "Tensor::d_lstm_cell");
+        if ((G->shape[0] != DH->shape[0]) || (G->shape[1] != 4 * DH->shape[1])) msg("Incompatible dims", "Tensor::d_lstm_cell");
+
+        G->tsem->lock();
+        cpu_d_lstm_cell(G, SH, X, prev_c, DH, DC, prev_dh, prev_dc);
+        G->tsem->unlock();
+    }
+
+// gW_k += A^T x DG_k for each gate k (biases when A is nullptr)
+    void lstm_grad(Tensor *A, Tensor *DG, vector<Tensor *> gW) {
+        if (!DG->isCPU()) msg("Only implemented for CPU", "Tensor::lstm_grad");
+        if ((A != nullptr) && (A->shape[0] != DG->shape[0])) msg("Incompatible dims", "Tensor::lstm_grad");
+
+        cpu_lstm_grad(A, DG, gW);
+    }
+
+}
@@ -0,0 +1,65 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+namespace tensorNN {
+
+
+// Adam / AdamW step: M=b1*M+(1-b1)*G, V=b2*V+(1-b2)*G^2, P-=lr*M'/sqrt(V'+eps)
+    void adam(Tensor *P, Tensor *G, Tensor *M, Tensor *V, float lr, float beta_1, float beta_2, float epsilon,
+              float weight_decay, bool decoupled, int t) {
+        if ((P->device != G->device) || (P->device != M->device) || (P->device != V->device))
+            msg("Tensors in different devices", "Tensor::adam");
+        if ((!Tensor::sameShape(P, G)) || (!Tensor::sameShape(P, M)) || (!Tensor::sameShape(P, V)))
+            msg("Incompatible dims", "Tensor::adam");
+
+        if (P->isCPU()) {
+            cpu_adam(P, G, M, V, lr, beta_1, beta_2, epsilon, weight_decay, decoupled, t);
+        }
+        else {
+            msg("Fused Adam is only available on CPU", "Tensor::adam");
+        }
+    }
+
+
+// Sparse rows are only tracked for tensors in CPU
+    static void check_rows(Tensor *P, vector<Tensor *> T, const vector<int> &rows, string title) {
+        if (!P->isCPU())
+            msg("Row-sparse updates are only available on CPU", title);
+        for (auto *A : T)
+            if ((A->device != P->device) || (!Tensor::sameShape(P, A)))
+                msg("Incompatible tensors", title);
+        for (int r : rows)
+            if ((r < 0) || (r >= P->shape[0]))
+                msg("Row out of range", title);
+    }
+
+    void zero_rows(Tensor *A, const vector<int> &rows) {
+        check_rows(A, {}, rows, "Tensor::zero_rows");
+        cpu_zero_rows(A, rows);
+    }
+
+    void sgd_rows(Tensor *P, Tensor *G, Tensor *M, const vector<int> &rows, float lr, float mu) {
+        check_rows(P, {G, M}, rows, "Tensor::sgd_rows");
+        cpu_sgd_rows(P, G, M, rows, lr, mu);
+    }
+
+    void adam_rows(Tensor *P, Tensor *G, Tensor *M, Tensor *V, const vector<int> &rows, float lr, float beta_1,
+                   float beta_2, float epsilon, float weight_decay, bool decoupled, int t) {
+        check_rows(P, {G, M, V}, rows, "Tensor::adam_rows");
+        cpu_adam_rows(P, G, M, V, rows, lr, beta_1, beta_2, epsilon, weight_decay, decoupled, t);
+    }
+
+    void rmsprop_rows(Tensor *P, Tensor *G, Tensor *G1, const vector<int> &rows, float lr, float rho, float epsilon) {
+        check_rows(P, {G, G1}, rows, "Tensor::rmsprop_rows");
+        cpu_rmsprop_rows(P, G, G1, rows, lr, rho, epsilon);
+    }
+
+}
@@ -0,0 +1,31 @@
+/*
+* EDDL Library - European Distributed Deep Learning Library.
+* Version: 0.7
+* copyright (c) 2020, Universidad Politécnica de Valencia (UPV), PRHLT Research Centre
+* Date: April 2020
+* Author: PRHLT Research Centre, UPV, (rparedes@prhlt.upv.es), (jon@prhlt.upv.es)
+* All rights reserved
+*/
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+namespace tensorNN {
+
+
+// C = act(A x W + bias) with the int8 weights of Q (see Net::quantize)
+    void QDense(Tensor *A, QuantDescriptor *Q, Tensor *bias, Tensor *C, int act) {
+        if ((A->ndim != 2) || (C->ndim != 2)) msg("Tensors are not 2D", "Tensor::QDense");
+        if ((A->shape[1] != Q->nin) || (C->shape[1] != Q->nout) || (A->shape[0] != C->shape[0]))
+            msg("Incompatible dims", "Tensor::QDense");
+
+        C->tsem->lock();
+        if (A->isCPU()) {
+            cpu_qdense(A, Q, bias, C, act);
+        }
+        else {
+            msg("Only implemented for CPU", "Tensor::QDense");
+        }
+        C->tsem->unlock();
+    }
+
+}
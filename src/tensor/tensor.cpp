@@ -137,7 +137,8 @@ void Tensor::deleteData(){
     // Carefpdal, you can't know is a pointer is allocated
     if(this->ptr != nullptr){
         if (this->isCPU()) {
-            delete[] this->ptr;
+            if (!this->isshared) free_fmem(this->ptr);
+            this->isshared = false;
 
             // Delete eigen matrix
             if (this->ndim == 2){
@@ -171,7 +172,7 @@ void Tensor::updateData(float *fptr, void *fptr2){
     if (this->isCPU()) {
         // If null => Reserve memory
         // else => point to data
-        if (fptr==nullptr) { this->ptr = get_fmem(this->size,"Tensor::updateData"); }
+        if (fptr==nullptr) { this->ptr = get_fmem(this->size,"Tensor::updateData"); this->isshared = false; }
         else { this->ptr = fptr; };
 
         // For 2 dimensions, map to data to Eigen for efficiency
@@ -298,7 +299,7 @@ void Tensor::toGPU(int dev){
 
         this->ptr = gpu_ptr;
         gpu_copy_to_gpu(cpu_ptr, this);
-        delete cpu_ptr;
+        free_fmem(cpu_ptr);
     }
     else if (this->isGPU())
     {
@@ -48,6 +48,20 @@ void Tensor::fill(Tensor* A, float v){
 
 
 void Tensor::permute_(const vector<int>& dims){
+    vector<int> new_shape = permute_shape(this->shape, dims);
+
+    if (this->isCPU()) {
+        // Square transposes are done in place, the rest through a scratch tensor
+        if (!cpu_permute_(this, dims)) {
+            auto *temp = new Tensor(new_shape, this->device);
+            cpu_permute(this, temp, dims);
+            cpu_copy(temp, this);
+            delete temp;
+        }
+        this->reshape_(new_shape);
+        return;
+    }
+
     Tensor* temp = Tensor::permute(this, dims);
 
     // Update attributes
@@ -61,6 +75,13 @@ void Tensor::permute_(const vector<int>& dims){
 
 
 Tensor* Tensor::permute(Tensor* A, const vector<int>& dims){
+    // CPU: addresses computed from the strides (no descriptor)
+    if (A->isCPU()) {
+        auto *new_t = new Tensor(permute_shape(A->shape, dims), A->device);
+        cpu_permute(A, new_t, dims);
+        return new_t;
+    }
+
     // Build descriptor
     auto *sd = new PermuteDescriptor(dims, A->device);
     sd->build(A->shape);
@@ -76,58 +97,29 @@ Tensor* Tensor::permute(Tensor* A, const vector<int>& dims){
 }
 
 
-void Tensor::moveaxis_(int source, int destination){
-    Tensor* temp = Tensor::moveaxis(this, source, destination);
-
-    // Update attributes
-    updateShape(temp->shape);
-    updateSize();
-    updateStrides();
-    Tensor::copy(temp, this);  // copy data
-
-    delete temp;
-}
-
-
-Tensor* Tensor::moveaxis(Tensor* A, int source, int destination){
+static vector<int> moveaxis_dims(int ndim, int source, int destination){
     // Check values
     if(source<-1 || destination <-1){
         msg("Invalid axis", "Tensor::moveaxis");
     }
 
     // User "-1" as alias for the last dimension
-    if(source == -1){source = A->ndim-1; }
-    if(destination == -1){destination = A->ndim-1; }
+    if(source == -1){source = ndim-1; }
+    if(destination == -1){destination = ndim-1; }
 
     // Build axes to permute [1 => 3] => (0,1,2,3) => (0,2,3,1)
     vector<int> dims;
-    dims.reserve(A->ndim);
-    for(int i=0; i<A->ndim;i++){
+    dims.reserve(ndim);
+    for(int i=0; i<ndim;i++){
         dims.push_back(i);
     }
     dims.erase(dims.begin()+source);  // Remove axis
     dims.insert(dims.begin() + destination, source);  // Insert at final position
-
-    // Permute tensor
-    Tensor* t2 = Tensor::permute(A, dims);
-    return t2;
-}
-
-
-void Tensor::swapaxis_(int axis1, int axis2){
-    Tensor* temp = Tensor::swapaxis(this, axis1, axis2);
-
-    // Update attributes
-    updateShape(temp->shape);
-    updateSize();
-    updateStrides();
-    Tensor::copy(temp, this);  // copy data
-
-    delete temp;
+    return dims;
 }
 
 
-Tensor* Tensor::swapaxis(Tensor* A, int axis1, int axis2){
+static vector<int> swapaxis_dims(int ndim, int axis1, int axis2){
     // Check values
     if(axis1<-1 || axis2 <-1 || axis1 == axis2){
         msg("Invalid axis", "Tensor::swapaxis");
@@ -135,13 +127,30 @@ Tensor* Tensor::swapaxis(Tensor* A, int axis1, int axis2){
 
     // Build axes to permute [0, 3] => (0,1,2,3) => (3,1,2,0)
     vector<int> dims;
-    for(int i=0; i<A->ndim;i++){ dims.emplace_back(i); }
+    for(int i=0; i<ndim;i++){ dims.emplace_back(i); }
     dims[axis1] = axis2;
     dims[axis2] = axis1;
+    return dims;
+}
+
+
+void Tensor::moveaxis_(int source, int destination){
+    this->permute_(moveaxis_dims(this->ndim, source, destination));
+}
+
+
+Tensor* Tensor::moveaxis(Tensor* A, int source, int destination){
+    return Tensor::permute(A, moveaxis_dims(A->ndim, source, destination));
+}
 
-    // Permute tensor
-    Tensor* t2 = Tensor::permute(A, dims);
-    return t2;
+
+void Tensor::swapaxis_(int axis1, int axis2){
+    this->permute_(swapaxis_dims(this->ndim, axis1, axis2));
+}
+
+
+Tensor* Tensor::swapaxis(Tensor* A, int axis1, int axis2){
+    return Tensor::permute(A, swapaxis_dims(A->ndim, axis1, axis2));
 }
 
 
@@ -340,6 +349,7 @@ void Tensor::copy(Tensor *A, Tensor *B) {
         fprintf(stderr, "(%d %d)\n", A->device, B->device);
         msg("unsupported copy between devices", "Tensor::copy");
     }
+    B->version++;
     B->tsem->unlock();
 }
 
@@ -436,3 +436,32 @@ void Tensor::cutout_random(Tensor *A, Tensor *B, vector<float> factor_x, vector<
     }
 #endif
 }
+
+void Tensor::affine_random(Tensor *A, Tensor *B, vector<float> rotation, vector<float> scale, vector<float> shift_x, vector<float> shift_y, int flip_axis, vector<float> crop_scale, vector<float> cutout_x, vector<float> cutout_y, bool bilinear, WrappingMode mode, float cval) {
+    // Parameter check
+    if(scale[0] <= 0.0f || scale[1] <= 0.0f){
+        msg("The scaling factor must be a positive number", "Tensor::affine_random");
+    } else if(shift_x[0] < -1.0f || shift_x[1] > 1.0f || shift_y[0] < -1.0f || shift_y[1] > 1.0f){
+        msg("The shift factors must fall within the range [-1.0, 1.0]", "Tensor::affine_random");
+    } else if(flip_axis < -1 || flip_axis > 1){
+        msg("The flip axis must be -1 (none), 0 or 1", "Tensor::affine_random");
+    } else if(crop_scale[0] <= 0.0f || crop_scale[1] > 1.0f){
+        msg("The crop factors must fall within the range (0.0, 1.0]", "Tensor::affine_random");
+    } else if(cutout_x[0] < 0.0f || cutout_x[1] > 1.0f || cutout_y[0] < 0.0f || cutout_y[1] > 1.0f){
+        msg("The cutout factors must fall within the range [0.0, 1.0]", "Tensor::affine_random");
+    }
+
+    // Check dimensions
+    if(A->shape!=B->shape){
+        msg("Incompatible dimensions", "Tensor::affine_random");
+    } else if (A->ndim != 4 || B->ndim != 4){
+        msg("This method requires two 4D tensors", "Tensor::affine_random");
+    }
+
+    if (A->isCPU()) {
+        cpu_affine_random(A, B, std::move(rotation), std::move(scale), std::move(shift_x), std::move(shift_y), flip_axis, std::move(crop_scale), std::move(cutout_x), std::move(cutout_y), bilinear, mode, cval);
+    }
+    else {
+        msg("Only implemented for CPU", "Tensor::affine_random");
+    }
+}
@@ -11,6 +11,8 @@
 
 #include "eddl/tensor/tensor.h"
 #include "eddl/hardware/cpu/cpu_tensor.h"
+#include "eddl/hardware/cpu/cpu_allocator.h"
+#include "eddl/hardware/cpu/cpu_half.h"
 #include "eddl/utils.h"
 #include "eddl/helpers.h"
 
@@ -37,6 +39,19 @@
 
 using namespace std;
 
+// Bin files saved with Tensor::save(..., aligned=true) pad the header to 64
+// bytes, so the data of a mapped file is aligned as get_fmem memory. Bit 15 of
+// the first word flags it. By default the header is not padded (the format
+// read by older versions)
+#define BIN_ALIGNED (1 << 15)
+#define BIN_ALIGNMENT 64
+
+static size_t bin_header_size(int ndim, bool aligned){
+    size_t bytes = (ndim + 1) * sizeof(int);
+    if (aligned) bytes = (bytes + BIN_ALIGNMENT - 1) / BIN_ALIGNMENT * BIN_ALIGNMENT;
+    return bytes;
+}
+
 // ********* LOAD FUNCTIONS *********
 Tensor* Tensor::load(const string& filename, string format){
     // Infer format from filename
@@ -79,20 +94,32 @@ Tensor* Tensor::loadfs(std::ifstream &ifs, string format) {
 Tensor* Tensor::load_from_bin(std::ifstream &ifs){
     int r_ndim;
 
-    // Load number of dimensions
+    // Load number of dimensions (the storage type is in the upper bits)
     ifs.read(reinterpret_cast<char *>(&r_ndim),  sizeof(int));
+    int r_dtype = r_ndim >> 16;
+    bool aligned = (r_ndim & BIN_ALIGNED) != 0;
+    r_ndim &= BIN_ALIGNED - 1;
 
     // Load dimensions
     vector<int> r_shape(r_ndim);
     ifs.read(reinterpret_cast<char *>(r_shape.data()), r_ndim * sizeof(int));
+    if (aligned) ifs.ignore(bin_header_size(r_ndim, true) - bin_header_size(r_ndim, false));
 
     // Compute total size
     int r_size = 1;
     for(int i=0; i<r_ndim; i++){ r_size *= r_shape[i]; }
 
     // Load content (row-major)
-    auto *r_ptr = new float[r_size];
-    ifs.read(reinterpret_cast<char*>(r_ptr), r_size * sizeof(float));
+    auto *r_ptr = get_fmem(r_size, "Tensor::load_from_bin");
+    if (r_dtype == DTYPE_FLOAT32){
+        ifs.read(reinterpret_cast<char*>(r_ptr), r_size * sizeof(float));
+    } else if (r_dtype == DTYPE_BFLOAT16 || r_dtype == DTYPE_FLOAT16){
+        vector<uint16_t> r_half(r_size);
+        ifs.read(reinterpret_cast<char*>(r_half.data()), r_size * sizeof(uint16_t));
+        cpu_half_to_float(r_half.data(), r_ptr, r_size, r_dtype);
+    } else {
+        msg("Unsupported storage type in bin file: " + to_string(r_dtype), "Tensor::load_from_bin");
+    }
 
     // Return new tensor
     auto *t1 = new Tensor(r_shape, r_ptr, DEV_CPU);
@@ -100,6 +127,45 @@ Tensor* Tensor::load_from_bin(std::ifstream &ifs){
     return t1;
 }
 
+Tensor* Tensor::load_mapped(const string& filename, bool sequential){
+    std::ifstream ifs(filename, std::ios::in | std::ios::binary);
+    if (!ifs.good()){
+        msg("File cannot be opened: " + filename, "Tensor::load_mapped");
+    }
+
+    // Header: number of dimensions and dimensions
+    int r_ndim = 0;
+    ifs.read(reinterpret_cast<char *>(&r_ndim),  sizeof(int));
+    if (!ifs.good() || (r_ndim & (BIN_ALIGNED - 1)) <= 0){
+        msg("Invalid bin file: " + filename, "Tensor::load_mapped");
+    }
+    if ((r_ndim >> 16) != DTYPE_FLOAT32){
+        msg("Only float32 bin files can be mapped: " + filename, "Tensor::load_mapped");
+    }
+    bool aligned = (r_ndim & BIN_ALIGNED) != 0;
+    r_ndim &= BIN_ALIGNED - 1;
+    vector<int> r_shape(r_ndim);
+    ifs.read(reinterpret_cast<char *>(r_shape.data()), r_ndim * sizeof(int));
+
+    size_t r_size = 1;
+    for(int i=0; i<r_ndim; i++){ r_size *= r_shape[i]; }
+
+    size_t offset = bin_header_size(r_ndim, aligned);
+    ifs.seekg(0, std::ios::end);
+    if ((size_t)ifs.tellg() < offset + r_size * sizeof(float)){
+        msg("Truncated bin file: " + filename, "Tensor::load_mapped");
+    }
+    ifs.close();
+
+    // The data is not read, pages are brought in on first access
+    auto *r_ptr = (float *)cpu_map_file(filename.c_str(), offset, r_size * sizeof(float), sequential);
+    if (r_ptr == nullptr){
+        msg("File cannot be mapped: " + filename, "Tensor::load_mapped");
+    }
+
+    return new Tensor(r_shape, r_ptr, DEV_CPU);
+}
+
 Tensor* Tensor::load_from_onnx(std::ifstream &ifs){
     msg("Not implemented", "Tensor::load_from_onnx");
 
@@ -121,7 +187,7 @@ Tensor* Tensor::load_from_img(const string &filename, const string &format){
         // Cast pointer
         // Data in row-major
         t_size = t_width * t_height * t_channels;
-        auto *t_data = new float[t_size];
+        auto *t_data = get_fmem(t_size, "Tensor::load_from_img");
         for (int i = 0; i < t_size; i++) { t_data[i] = (float) pixels[i]; }
 
         // Free image
@@ -194,7 +260,7 @@ Tensor* Tensor::load_from_img(const string &filename, const string &format){
 
 
 // ********* SAVE FUNCTIONS *********
-void Tensor::save(const string& filename, string format) {
+void Tensor::save(const string& filename, string format, const string& dtype, bool aligned) {
     // Check if the folder exists
     string folder = filename.substr(0, filename.find_last_of("\\/"));
     if(folder != filename && !pathExists(folder)){
@@ -208,10 +274,18 @@ void Tensor::save(const string& filename, string format) {
 
     if(format=="png" || format=="bmp" || format=="tga" || format=="jpg" || format=="jpeg" || format=="hdr") { // Images
         save2img(filename, format);
+    }else if(format=="bin" && aligned){
+        // On its own: padded header (see load_mapped)
+        if (!isCPU()){
+            msg("Only save CPU Tensors", "Tensor::save");
+        }
+        std::ofstream ofs(filename, std::ios::out | std::ios::binary);
+        save2bin(ofs, get_dtype(dtype), true);
+        ofs.close();
     }else if(format=="bin" || format=="onnx" || format=="csv" || format=="tsv" || format=="txt"){
         // Open file stream, save tensor and close filesteam
         std::ofstream ofs(filename, std::ios::out | std::ios::binary);
-        Tensor::savefs(ofs, format);
+        Tensor::savefs(ofs, format, dtype);
         ofs.close();
     }else if(format=="npy" || format=="npz"){
         msg("Format deprecated in favor of python: *.'" + format + "'", "Tensor::save");
@@ -221,14 +295,14 @@ void Tensor::save(const string& filename, string format) {
     }
 }
 
-void Tensor::savefs(std::ofstream &ofs, string format) {
+void Tensor::savefs(std::ofstream &ofs, string format, const string& dtype) {
     if (!isCPU()){
         msg("Only save CPU Tensors", "Tensor::save");
     }
 
     // Choose format
     if(format=="bin") {
-        save2bin(ofs);
+        save2bin(ofs, get_dtype(dtype));
     } else if(format=="onnx"){
         save2onnx(ofs);
     } else if(format=="csv" || format=="tsv" || format=="txt"){
@@ -244,15 +318,32 @@ void Tensor::savefs(std::ofstream &ofs, string format) {
 }
 
 
-void Tensor::save2bin(std::ofstream &ofs){
-    // Save number of dimensions
-    ofs.write(reinterpret_cast<const char *>(&this->ndim), sizeof(int));
+void Tensor::save2bin(std::ofstream &ofs, int dtype, bool aligned){
+    if (dtype != DTYPE_FLOAT32 && dtype != DTYPE_BFLOAT16 && dtype != DTYPE_FLOAT16){
+        msg("Only float32, bfloat16 and float16 bin files are supported", "Tensor::save2bin");
+    }
+
+    // Save number of dimensions, and the storage type in the upper bits
+    // (0 for float32, so these files are the same as before)
+    int header = this->ndim | (dtype << 16);
+    if (aligned) header |= BIN_ALIGNED;
+    ofs.write(reinterpret_cast<const char *>(&header), sizeof(int));
 
     // Save dimensions
     ofs.write(reinterpret_cast<const char *>(this->shape.data()), this->shape.size() * sizeof(int));
+    if (aligned) {
+        vector<char> pad(bin_header_size(this->ndim, true) - bin_header_size(this->ndim, false), 0);
+        ofs.write(pad.data(), pad.size());
+    }
 
     // Save content (row-major)
-    ofs.write(reinterpret_cast<const char *>(this->ptr), this->size * sizeof(float));
+    if (dtype == DTYPE_FLOAT32){
+        ofs.write(reinterpret_cast<const char *>(this->ptr), this->size * sizeof(float));
+    } else {
+        vector<uint16_t> half(this->size);
+        cpu_float_to_half(this->ptr, half.data(), this->size, dtype);
+        ofs.write(reinterpret_cast<const char *>(half.data()), this->size * sizeof(uint16_t));
+    }
 }
 
 void Tensor::save2onnx(std::ofstream &ofs){
@@ -29,6 +29,7 @@
 
 #include "eddl/system_info.h"
 #include "eddl/utils.h"
+#include "eddl/hardware/cpu/cpu_allocator.h"
 
 #ifdef EDDL_LINUX
 #include "sys/mman.h"
@@ -67,41 +68,26 @@ void msg(const string& text, const string& title) {
 float *get_fmem(unsigned long int size, const string &str){
     // Careful with memory overcommitment:
     // https://stackoverflow.com/questions/48585079/malloc-on-linux-without-overcommitting
-    // TODO: This function does not work properly (...but it does, at least most of the time -for linux and mac-)
-    float* ptr = nullptr;
-    bool error = false;
-
-
-    // Check if free memory is bigger than requested
-    unsigned long freemem = get_free_mem();
-    if (size*sizeof(float) > freemem) {
-        error=true;
-    }
-
-    // New vs Malloc *******************
-    // New is the C++ way of doing it
-    // New is type-safe, Malloc is not
-    // New calls your type constructor, Malloc not - Same for destructor
-    // New is an operator, Malloc a function (slower)
-    try{
-        ptr = new float[size];
-        //ptr=(float *)malloc(size*sizeof(float));
-        //ptr=aligned_alloc(64, size*sizeof(float));
-    }
-    catch (std::bad_alloc& badAlloc){
-        error=true;
+    // Reading the free memory is expensive, so only the big requests are checked (the pool
+    // serves the rest, most of the time without going to the system)
+    unsigned long int bytes = size * sizeof(float);
+    if (bytes >= FMEM_CHECK_THRESHOLD && bytes > get_free_mem()) {
+        throw std::runtime_error("Error allocating " + string(bytes2human(bytes)) + " in " + string(str));
     }
 
-    // Check for errors
-    // Not enough free memory
-    if (error) {
-        delete ptr;
-        throw std::runtime_error("Error allocating " + string(bytes2human(size * sizeof(float))) + " in " + string(str));
+    // Aligned to CPU_POOL_ALIGNMENT
+    auto *ptr = (float *)cpu_pool_alloc(bytes);
+    if (ptr == nullptr) {
+        throw std::runtime_error("Error allocating " + string(bytes2human(bytes)) + " in " + string(str));
     }
 
     return ptr;
 }
 
+void free_fmem(float *ptr){
+    cpu_pool_free(ptr);
+}
+
 
 string bytes2human(unsigned long long int bytes, int decimals){
     vector<string> prefix = {"B", "KB", "MB", "GB", "TB", "PB", "EB", "ZB", "YB"};
@@ -187,6 +173,15 @@ string get_extension(string filename){
     return "";
 }
 
+int get_dtype(const string &name){
+    if (name=="float32" || name=="float") return DTYPE_FLOAT32;
+    if (name=="bfloat16" || name=="bf16") return DTYPE_BFLOAT16;
+    if (name=="float16" || name=="fp16") return DTYPE_FLOAT16;
+    if (name=="int8") return DTYPE_INT8;
+    msg("Unknown dtype: " + name, "get_dtype");
+    return -1;
+}
+
 vector<vector<int>> parse_indices(vector<string> str_indices, const vector<int>& shape){
     string delimiter(":");
     vector<vector<int>> ranges;
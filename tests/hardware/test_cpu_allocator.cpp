@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+
+#include "eddl/utils.h"
+#include "eddl/hardware/cpu/cpu_allocator.h"
+#include "eddl/tensor/tensor.h"
+
+
+TEST(CPUAllocatorTestSuite, alignment){
+    for (size_t bytes : {1, 4, 63, 64, 65, 300, 1000, 4097, 100000, 3000000}) {
+        void *ptr = cpu_pool_alloc(bytes);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ((uintptr_t) ptr % CPU_POOL_ALIGNMENT, 0);
+        cpu_pool_free(ptr);
+    }
+
+    Tensor *t = Tensor::zeros({3, 5, 7});
+    ASSERT_EQ((uintptr_t) t->ptr % CPU_POOL_ALIGNMENT, 0);
+    ASSERT_TRUE(cpu_pool_owns(t->ptr));
+    delete t;
+}
+
+TEST(CPUAllocatorTestSuite, reuse_size_classes){
+    // 1000 and 1020 bytes share the 1024 bucket, 1200 goes to the 1280 one
+    void *a = cpu_pool_alloc(1000);
+    cpu_pool_free(a);
+
+    CPUPoolStats s = cpu_pool_stats();
+    void *b = cpu_pool_alloc(1020);
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(cpu_pool_stats().hits, s.hits + 1);
+
+    void *c = cpu_pool_alloc(1200);
+    ASSERT_NE(c, b);
+    cpu_pool_free(b);
+    cpu_pool_free(c);
+
+    // Small blocks are rounded to the alignment
+    void *d = cpu_pool_alloc(65);
+    cpu_pool_free(d);
+    ASSERT_EQ(cpu_pool_alloc(128), d);
+    cpu_pool_free(d);
+}
+
+TEST(CPUAllocatorTestSuite, free_and_release){
+    CPUPoolStats s = cpu_pool_stats();
+    float *ptr = get_fmem(1 << 20, "test");
+    ASSERT_TRUE(cpu_pool_owns(ptr));
+    ASSERT_GE(cpu_pool_stats().in_use, s.in_use + (4 << 20));
+
+    free_fmem(ptr);
+    ASSERT_FALSE(cpu_pool_owns(ptr));
+    ASSERT_EQ(cpu_pool_stats().in_use, s.in_use);
+    ASSERT_GE(cpu_pool_stats().cached, 4 << 20);
+
+    // Trimming gives the cached blocks back to the system
+    cpu_pool_trim(0);
+    ASSERT_EQ(cpu_pool_stats().cached, 0);
+    ASSERT_GT(cpu_pool_stats().releases, s.releases);
+
+    // As at exit: with no limit the freed blocks are released, not cached
+    cpu_pool_set_limit(0);
+    size_t releases = cpu_pool_stats().releases;
+    free_fmem(get_fmem(1000, "test"));
+    ASSERT_EQ(cpu_pool_stats().cached, 0);
+    ASSERT_EQ(cpu_pool_stats().releases, releases + 1);
+    cpu_pool_set_limit(CPU_POOL_DEFAULT_LIMIT);
+
+    // Buffers from outside the pool are released with delete[]
+    cpu_pool_free(new float[10]);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/hardware/cpu/cpu_profile.h"
+
+
+// Kernels record from the OpenMP workers while another thread toggles the
+// profiler and reads the buffers
+TEST(CPUProfileTestSuite, concurrent_toggle_and_export){
+    Tensor *t = Tensor::zeros({64, 1024});
+    Tensor *t2 = Tensor::zeros({64, 1024});
+    std::atomic<bool> done(false);
+
+    std::thread control([&done]() {
+        for (int i = 0; i < 200; i++) {
+            _profile_enable(true);
+            if (i % 10 == 0) _profile_reset();
+            if (i % 25 == 0) _profile_export_trace("eddl_profile_test.json");
+            _profile_disable();
+        }
+        done = true;
+    });
+    while (!done) Tensor::copy(t, t2);
+    control.join();
+
+    // And the events of a profiled run are exported
+    _profile_enable(true);
+    _profile_reset();
+    Tensor::copy(t, t2);
+    _profile_disable();
+    _profile_export_trace("eddl_profile_test.json");
+
+    std::ifstream f("eddl_profile_test.json");
+    std::stringstream ss;
+    ss << f.rdbuf();
+    ASSERT_NE(ss.str().find("\"cat\":\"kernel\""), std::string::npos);
+    std::remove("eddl_profile_test.json");
+    delete t;
+    delete t2;
+}
+
+// A scope open across a reset is not recorded (it began before the new t0)
+TEST(CPUProfileTestSuite, reset_drops_open_scopes){
+    _profile_enable(true);
+    _profile_reset();
+    _profile_scope_begin("before_reset", "test");
+    _profile_reset();
+    _profile_scope_begin("after_reset", "test");
+    _profile_scope_end();
+    _profile_scope_end();
+    _profile_disable();
+    _profile_export_trace("eddl_profile_test.json");
+
+    std::ifstream f("eddl_profile_test.json");
+    std::stringstream ss;
+    ss << f.rdbuf();
+    ASSERT_NE(ss.str().find("after_reset"), std::string::npos);
+    ASSERT_EQ(ss.str().find("before_reset"), std::string::npos);
+    std::remove("eddl_profile_test.json");
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <algorithm>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/hardware/cpu/nn/cpu_tensor_nn.h"
+
+
+TEST(SoftmaxTestSuite, exp_nonpos_error_bound){
+    // Whole range that is not clamped (exp(-87) is still a normal float)
+    double max_err = 0.0;
+    for (int i = 0; i <= 1000000; i++) {
+        float x = -87.0f * (float)i / 1000000.0f;
+        double ref = std::exp((double)x);
+        max_err = std::max(max_err, std::fabs(cpu_exp_nonpos(x) - ref) / ref);
+    }
+    ASSERT_LT(max_err, 5e-7);
+    ASSERT_EQ(cpu_exp_nonpos(0.0f), 1.0f);
+}
+
+TEST(SoftmaxTestSuite, softmax_vs_std_exp){
+    // Rows of different widths, with large and spread logits
+    for (int cols : {1, 3, 10, 1000}) {
+        Tensor *A = Tensor::randn({64, cols});
+        A->mult_(20.0f);
+        A->add_(50.0f);
+        Tensor *B = Tensor::empty({64, cols});
+        tensorNN::Softmax(A, B);
+
+        double max_err = 0.0;
+        for (int i = 0; i < 64; i++) {
+            const float *a = A->ptr + i * cols;
+            float max = *std::max_element(a, a + cols);
+            double sum = 0.0;
+            for (int j = 0; j < cols; j++) sum += std::exp((double)a[j] - max);
+            for (int j = 0; j < cols; j++) {
+                double ref = std::exp((double)a[j] - max) / sum;
+                max_err = std::max(max_err, std::fabs(B->ptr[i * cols + j] - ref));
+            }
+        }
+        ASSERT_LT(max_err, 1e-6);
+        delete A;
+        delete B;
+    }
+}
@@ -2,6 +2,9 @@
 #include <string>
 
 #include "eddl/descriptors/descriptors.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/conv/layer_conv.h"
 
 
 using namespace std;
@@ -43,3 +46,245 @@ TEST(Convol2DTestSuite, output_size)
         }
     }
 }
+
+
+TEST(Convol2DTestSuite, cpu_algorithms)
+{
+    // Winograd and direct 1x1 must match the im2col lowering
+    vector<vector<int>> cases = {{3, 13, 11}, {3, 5, 6}, {1, 7, 7}};  // kernel, rows, cols
+    for(auto& cs : cases){
+        Tensor* t_input = Tensor::randn({2, 8, cs[1], cs[2]});
+        auto *cd = new ConvolDescriptor(8, {cs[0], cs[0]}, {1, 1}, cs[0]==3 ? "same" : "valid", true);
+        cd->build(t_input);
+        cd->K->rand_normal(0.0f, 1.0f);
+        cd->bias->rand_normal(0.0f, 1.0f);
+        cd->D = Tensor::randn(cd->O->getShape());
+
+        vector<int> algos = {CONV_ALGO_IM2COL, CONV_ALGO_DIRECT_1X1};
+        if (cs[0]==3) algos = {CONV_ALGO_IM2COL, CONV_ALGO_WINOGRAD_2X2, CONV_ALGO_WINOGRAD_4X4};
+
+        Tensor *t_out = nullptr, *t_grad = nullptr, *t_delta = nullptr;
+        for(auto& algo : algos){
+            cd->set_cpu_algo(algo);
+            cd->ID = Tensor::zeros(t_input->getShape());
+            cd->gK->fill_(0.0f);
+            cd->gbias->fill_(0.0f);
+
+            tensorNN::Conv2D(cd);
+            tensorNN::Conv2D_grad(cd);
+            tensorNN::Conv2D_back(cd);
+
+            if (algo==CONV_ALGO_IM2COL) {
+                t_out = cd->O->clone(); t_grad = cd->gK->clone(); t_delta = cd->ID->clone();
+            } else {
+                ASSERT_TRUE((bool) Tensor::equivalent(t_out, cd->O, 10e-4f));
+                ASSERT_TRUE((bool) Tensor::equivalent(t_grad, cd->gK, 10e-4f));
+                ASSERT_TRUE((bool) Tensor::equivalent(t_delta, cd->ID, 10e-4f));
+            }
+            delete cd->ID;
+        }
+        delete t_out; delete t_grad; delete t_delta;
+    }
+}
+
+
+TEST(Convol2DTestSuite, cpu_mem_levels)
+{
+    // Lowering the whole batch, per sample or per tile (with the im2col walk
+    // of odd shapes and strides) gives the same results
+    vector<vector<int>> cases = {{3, 20, 20, 1}, {3, 28, 28, 2}, {2, 9, 7, 2}};  // kernel, rows, cols, stride
+    for(auto& cs : cases){
+        Tensor* t_input = Tensor::randn({3, 4, cs[1], cs[2]});
+        auto *cd = new ConvolDescriptor(5, {cs[0], cs[0]}, {cs[3], cs[3]}, "same", true);
+        cd->build(t_input);
+        cd->set_cpu_algo(CONV_ALGO_IM2COL);
+        cd->K->rand_normal(0.0f, 1.0f);
+        cd->bias->rand_normal(0.0f, 1.0f);
+        cd->D = Tensor::randn(cd->O->getShape());
+
+        auto *ws = new ConvolWorkspace();
+        Tensor *t_out = nullptr, *t_grad = nullptr, *t_delta = nullptr;
+        vector<int> levels = {0, 0, 1, 2};
+        for(int run=0; run<levels.size(); run++){
+            int mem = levels[run];
+            cd->set_workspace(ws, mem);
+            cd->ID = Tensor::zeros(t_input->getShape());
+            cd->gK->fill_(0.0f);
+            cd->gbias->fill_(0.0f);
+
+            tensorNN::Conv2D(cd);
+            if (run==1) ws->owner=nullptr;  // built again, as if another layer had used it
+            tensorNN::Conv2D_grad(cd);
+            tensorNN::Conv2D_back(cd);
+
+            if (run==0) {
+                t_out = cd->O->clone(); t_grad = cd->gK->clone(); t_delta = cd->ID->clone();
+            } else {
+                ASSERT_TRUE((bool) Tensor::equivalent(t_out, cd->O, 10e-4f));
+                ASSERT_TRUE((bool) Tensor::equivalent(t_grad, cd->gK, 10e-4f));
+                ASSERT_TRUE((bool) Tensor::equivalent(t_delta, cd->ID, 10e-4f));
+            }
+            delete cd->ID;
+        }
+        delete t_out; delete t_grad; delete t_delta;
+        delete cd; delete ws;
+    }
+}
+
+
+// Direct (and slow) convolution of cd->I: output, kernel gradient and input
+// delta for the delta cd->D
+static void conv_reference(ConvolDescriptor *cd, Tensor *O, Tensor *gK, Tensor *ID)
+{
+    int ng = cd->nk / cd->groups;
+    for(int b=0; b<cd->I->shape[0]; b++)
+        for(int o=0; o<cd->nk; o++)
+            for(int y=0; y<cd->r; y++)
+                for(int x=0; x<cd->c; x++){
+                    int po = ((b*cd->nk + o)*cd->r + y)*cd->c + x;
+                    O->ptr[po] = cd->bias->ptr[o];
+                    for(int z=0; z<cd->kz; z++)
+                        for(int i=0; i<cd->kr; i++)
+                            for(int j=0; j<cd->kc; j++){
+                                int py = y*cd->sr - cd->padrt + i*cd->dr;
+                                int px = x*cd->sc - cd->padcl + j*cd->dc;
+                                if ((py<0) || (py>=cd->ir) || (px<0) || (px>=cd->ic)) continue;
+                                int pi = ((b*cd->iz + (o/ng)*cd->kz + z)*cd->ir + py)*cd->ic + px;
+                                int pk = ((o*cd->kz + z)*cd->kr + i)*cd->kc + j;
+                                O->ptr[po] += cd->I->ptr[pi] * cd->K->ptr[pk];
+                                gK->ptr[pk] += cd->D->ptr[po] * cd->I->ptr[pi];
+                                ID->ptr[pi] += cd->D->ptr[po] * cd->K->ptr[pk];
+                            }
+                }
+}
+
+TEST(Convol2DTestSuite, cpu_grouped_dilated)
+{
+    // input channels, filters, groups, kernel, stride, dilation, rows, cols, padding ("same" if 1)
+    vector<vector<int>> cases = {
+            {6, 6, 6, 3, 1, 1, 10, 10, 1},   // depthwise
+            {4, 8, 4, 3, 2, 2, 9, 8, 1},     // depthwise, two filters per channel
+            {6, 4, 2, 3, 1, 2, 11, 9, 0},    // grouped
+            {3, 5, 1, 3, 2, 3, 12, 10, 1},   // dilated
+            {3, 5, 1, 3, 2, 1, 8, 8, 1},     // stride 2 over an even size
+            {3, 5, 1, 2, 1, 1, 7, 6, 0},     // even kernel
+    };
+    for(auto& cs : cases){
+        Tensor* t_input = Tensor::randn({2, cs[0], cs[6], cs[7]});
+        auto *cd = new ConvolDescriptor(cs[1], {cs[3], cs[3]}, {cs[4], cs[4]}, cs[8] ? "same" : "valid", true, 0, cs[2], {cs[5], cs[5]});
+        cd->build(t_input);
+        cd->K->rand_normal(0.0f, 1.0f);
+        cd->bias->rand_normal(0.0f, 1.0f);
+        cd->D = Tensor::randn(cd->O->getShape());
+        ASSERT_EQ(cd->K->shape[1], cs[0] / cs[2]);
+
+        Tensor *t_out = Tensor::zeros(cd->O->getShape());
+        Tensor *t_grad = Tensor::zeros(cd->gK->getShape());
+        Tensor *t_delta = Tensor::zeros(t_input->getShape());
+        conv_reference(cd, t_out, t_grad, t_delta);
+
+        // the selected algorithm (depthwise when kz==1) and im2col, whole batch and tiled
+        vector<int> algos = {cd->cpu_algo, CONV_ALGO_IM2COL, CONV_ALGO_IM2COL};
+        for(int run=0; run<algos.size(); run++){
+            cd->set_cpu_algo(algos[run]);
+            cd->set_workspace(nullptr, (run==2) ? 2 : 0);
+            cd->ID = Tensor::zeros(t_input->getShape());
+            cd->gK->fill_(0.0f);
+
+            tensorNN::Conv2D(cd);
+            tensorNN::Conv2D_grad(cd);
+            tensorNN::Conv2D_back(cd);
+
+            ASSERT_TRUE((bool) Tensor::equivalent(t_out, cd->O, 10e-4f));
+            ASSERT_TRUE((bool) Tensor::equivalent(t_grad, cd->gK, 10e-4f));
+            ASSERT_TRUE((bool) Tensor::equivalent(t_delta, cd->ID, 10e-4f));
+            delete cd->ID;
+        }
+        delete t_out; delete t_grad; delete t_delta;
+        delete cd;
+    }
+}
+
+
+// Transposed convolution as the scatter of every input pixel over the output:
+// output, kernel and bias gradients and input delta for the output delta dY
+static void convt_reference(LConvT *l, Tensor *dY, Tensor *O, Tensor *gK, Tensor *gb, Tensor *ID)
+{
+    ConvolDescriptor *cd = l->cd;
+    Tensor *X = l->input;
+    int B = X->shape[0], C = X->shape[1], H = X->shape[2], W = X->shape[3];
+    int F = O->shape[1], Ho = O->shape[2], Wo = O->shape[3];
+    for(int b=0; b<B; b++)
+        for(int f=0; f<F; f++)
+            for(int i=0; i<Ho*Wo; i++){
+                O->ptr[(b*F + f)*Ho*Wo + i] = cd->bias->ptr[f];
+                gb->ptr[f] += dY->ptr[(b*F + f)*Ho*Wo + i];
+            }
+    for(int b=0; b<B; b++)
+        for(int c=0; c<C; c++)
+            for(int y=0; y<H; y++)
+                for(int x=0; x<W; x++){
+                    int px = ((b*C + c)*H + y)*W + x;
+                    for(int f=0; f<F; f++)
+                        for(int i=0; i<cd->kr; i++)
+                            for(int j=0; j<cd->kc; j++){
+                                int oy = y*cd->sr - cd->padrt + i*cd->dr;
+                                int ox = x*cd->sc - cd->padcl + j*cd->dc;
+                                if ((oy<0) || (oy>=Ho) || (ox<0) || (ox>=Wo)) continue;
+                                int po = ((b*F + f)*Ho + oy)*Wo + ox;
+                                int pk = ((c*F + f)*cd->kr + i)*cd->kc + j;
+                                O->ptr[po] += X->ptr[px] * cd->K->ptr[pk];
+                                gK->ptr[pk] += X->ptr[px] * dY->ptr[po];
+                                ID->ptr[px] += dY->ptr[po] * cd->K->ptr[pk];
+                            }
+                }
+}
+
+TEST(Convol2DTestSuite, cpu_transposed)
+{
+    // input channels, filters, kernel, stride, dilation, rows, cols, padding ("same" if 1), output padding
+    vector<vector<int>> cases = {
+            {3, 4, 3, 1, 1, 7, 6, 1, 0},
+            {4, 3, 4, 2, 1, 5, 6, 1, 0},     // upsampling x2
+            {4, 3, 3, 2, 1, 5, 6, 1, 1},     // output padding
+            {2, 5, 3, 3, 1, 4, 5, 0, 2},
+            {3, 2, 3, 2, 2, 6, 4, 0, 0},     // dilated
+            {3, 2, 2, 1, 1, 5, 5, 0, 0},     // even kernel
+    };
+    for(auto& cs : cases){
+        for(int mem=0; mem<=2; mem+=2){
+            auto *in = new LInput(Tensor::randn({2, cs[0], cs[5], cs[6]}), "", DEV_CPU, mem);
+            auto *l = new LConvT(in, cs[1], {cs[2], cs[2]}, {cs[8], cs[8]}, cs[7] ? "same" : "valid",
+                                 {cs[4], cs[4]}, {cs[3], cs[3]}, true, "", DEV_CPU, mem);
+            if (cs[7]) {
+                ASSERT_EQ(l->output->shape[2], cs[5]*cs[3]);
+                ASSERT_EQ(l->output->shape[3], cs[6]*cs[3]);
+            }
+            l->cd->set_workspace(nullptr, mem);
+            l->cd->K->rand_normal(0.0f, 1.0f);
+            l->cd->bias->rand_normal(0.0f, 1.0f);
+            l->cd->gK->fill_(0.0f);
+            l->cd->gbias->fill_(0.0f);
+            l->delta = Tensor::randn(l->output->getShape());
+            in->delta = Tensor::zeros(in->output->getShape());
+
+            Tensor *t_out = Tensor::zeros(l->output->getShape());
+            Tensor *t_grad = Tensor::zeros(l->cd->gK->getShape());
+            Tensor *t_gbias = Tensor::zeros(l->cd->gbias->getShape());
+            Tensor *t_delta = Tensor::zeros(in->output->getShape());
+            convt_reference(l, l->delta, t_out, t_grad, t_gbias, t_delta);
+
+            l->forward();
+            l->backward();
+
+            ASSERT_TRUE((bool) Tensor::equivalent(t_out, l->output, 10e-4f));
+            ASSERT_TRUE((bool) Tensor::equivalent(t_grad, l->cd->gK, 10e-4f));
+            ASSERT_TRUE((bool) Tensor::equivalent(t_gbias, l->cd->gbias, 10e-4f));
+            ASSERT_TRUE((bool) Tensor::equivalent(t_delta, in->delta, 10e-4f));
+
+            delete t_out; delete t_grad; delete t_gbias; delete t_delta;
+            delete l;
+            delete in;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/layers/core/layer_core.h"
+
+
+using namespace eddl;
+
+
+TEST(LayerTestSuite, embedding_sparse_grads){
+    int vocsize = 20, length = 4, dim = 3;
+    layer in = Input({length});
+    layer emb = Embedding(in, vocsize, length, dim);
+    layer out = Softmax(Dense(Reshape(emb, {-1}), 2));
+    model net = Model({in}, {out});
+    build(net, sgd(0.1f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    LEmbedding *e = (LEmbedding *)emb;
+    Tensor *y = new Tensor({1, 0, 0, 1}, {2, 2}, DEV_CPU);
+
+    // Repeated words in the same batch, and rows of the first batch unused in the second
+    vector<vector<float>> batches = {{1, 2, 2, 3, 3, 5, 1, 7}, {4, 4, 6, 8, 9, 4, 6, 10}};
+    for (auto &words : batches) {
+        Tensor *x = new Tensor(words, {2, length}, DEV_CPU);
+        Tensor *before = e->E->clone();
+        train_batch(net, {x}, {y});
+
+        // gE holds the sum of the deltas of each word and zeros elsewhere
+        Tensor *expected = Tensor::zeros({vocsize, dim});
+        for (int i = 0; i < words.size(); i++)
+            for (int j = 0; j < dim; j++)
+                expected->ptr[(int)words[i] * dim + j] += e->delta->ptr[i * dim + j];
+        ASSERT_TRUE((bool) Tensor::equivalent(e->gE, expected, 10e-5f));
+
+        // The lazy update only moves the touched rows, as the dense one would
+        Tensor::add(1.0f, before, -0.1f, expected, before, 0);
+        ASSERT_TRUE((bool) Tensor::equivalent(e->E, before, 10e-5f));
+        ASSERT_NE(e->sparse_rows(0), nullptr);
+
+        delete x; delete before; delete expected;
+    }
+    delete y;
+}
+
+// Batches that touch the same rows: the other rows keep zero moments, so the
+// lazy update of the touched rows must give the same weights as the dense one
+static void check_lazy_vs_dense(Optimizer *lazy, Optimizer *dense){
+    int vocsize = 20, length = 4, dim = 3;
+    Optimizer *opts[2] = {lazy, dense};
+    model nets[2];
+    LEmbedding *e[2];
+    for (int k = 0; k < 2; k++) {
+        layer in = Input({length});
+        layer emb = Embedding(in, vocsize, length, dim);
+        layer out = Softmax(Dense(Reshape(emb, {-1}), 2));
+        nets[k] = Model({in}, {out});
+        build(nets[k], opts[k], {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+        e[k] = (LEmbedding *)emb;
+    }
+    for (int i = 0; i < nets[0]->layers.size(); i++) nets[0]->layers[i]->copy(nets[1]->layers[i]);
+
+    Tensor *y = new Tensor({1, 0, 0, 1}, {2, 2}, DEV_CPU);
+    vector<vector<float>> batches = {{1, 2, 2, 3, 3, 5, 1, 7}, {7, 5, 3, 2, 1, 1, 2, 3}, {3, 3, 1, 7, 5, 2, 2, 1}};
+    for (auto &words : batches) {
+        Tensor *x = new Tensor(words, {2, length}, DEV_CPU);
+        train_batch(nets[0], {x}, {y});
+        ASSERT_NE(e[0]->sparse_rows(0), nullptr);
+
+        zeroGrads(nets[1]);
+        forward(nets[1], {x});
+        backward(nets[1], {y});
+        e[1]->gE_clean = false;  // as if any row could be written: dense update
+        ASSERT_EQ(e[1]->sparse_rows(0), nullptr);
+        update(nets[1]);
+
+        ASSERT_TRUE((bool) Tensor::equivalent(e[0]->E, e[1]->E, 10e-5f));
+        delete x;
+    }
+    delete y;
+    delete nets[0];
+    delete nets[1];
+}
+
+TEST(LayerTestSuite, embedding_lazy_adam){
+    check_lazy_vs_dense(adam(0.01f), adam(0.01f));
+}
+
+TEST(LayerTestSuite, embedding_lazy_rmsprop){
+    check_lazy_vs_dense(rmsprop(0.01f), rmsprop(0.01f));
+}
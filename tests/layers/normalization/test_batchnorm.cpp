@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+
+
+TEST(BatchNormTestSuite, batchnorm_nchw_forward_backward)
+{
+    // Input {2,1,2,2}: mean=4, var=3
+    auto *ptr_in = new float[2*1*2*2]{1, 3, 5, 7,
+                                      3, 5, 5, 3};
+    auto* t_in = new Tensor({2, 1, 2, 2}, ptr_in, DEV_CPU);
+
+    float sd = std::sqrt(3.0f);
+    auto *ptr_opa = new float[2*1*2*2]{-3/sd, -1/sd, 1/sd, 3/sd,
+                                       -1/sd, 1/sd, 1/sd, -1/sd};
+    auto* t_opa = new Tensor({2, 1, 2, 2}, ptr_opa, DEV_CPU);
+
+    auto* out = new Tensor({2, 1, 2, 2}, DEV_CPU);
+    auto* opa = new Tensor({2, 1, 2, 2}, DEV_CPU);
+    auto* mean = Tensor::zeros({1});
+    auto* variance = Tensor::ones({1});
+    auto* bn_mean = new Tensor({1});
+    auto* bn_var = new Tensor({1});
+    auto* bn_g = Tensor::full({1}, 2.0f);
+    auto* bn_b = Tensor::full({1}, 1.0f);
+
+    // Forward
+    tensorNN::BatchNormForward(t_in, out, opa, mean, variance, bn_g, bn_b, bn_mean, bn_var, 0.5f, 0.0f, 1);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_opa, opa, 10e-5f));
+    ASSERT_NEAR(bn_mean->ptr[0], 4.0f, 10e-5f);
+    ASSERT_NEAR(bn_var->ptr[0], sd, 10e-5f);  // sd
+    ASSERT_NEAR(mean->ptr[0], 2.0f, 10e-5f);
+    ASSERT_NEAR(variance->ptr[0], 2.0f, 10e-5f);
+    ASSERT_NEAR(out->ptr[0], 2.0f*(-3/sd)+1.0f, 10e-5f);
+
+    // Backward: a constant delta only moves beta
+    auto* delta = Tensor::ones({2, 1, 2, 2});
+    auto* pdelta = Tensor::zeros({2, 1, 2, 2});
+    auto* gbn_g = Tensor::zeros({1});
+    auto* gbn_b = Tensor::zeros({1});
+    tensorNN::BatchNormBackward(delta, opa, pdelta, gbn_g, gbn_b, bn_g, bn_var);
+    ASSERT_TRUE((bool) Tensor::equivalent(Tensor::zeros({2, 1, 2, 2}), pdelta, 10e-5f));
+    ASSERT_NEAR(gbn_g->ptr[0], 0.0f, 10e-5f);
+    ASSERT_NEAR(gbn_b->ptr[0], 1.0f, 10e-5f);
+}
+
+
+TEST(BatchNormTestSuite, batchnorm_2d_same_as_nchw)
+{
+    // {B,C} and {B,C,1,1} go through different kernels
+    Tensor* t_2d = Tensor::randn({16, 40});
+    Tensor* t_4d = t_2d->clone();
+    t_4d->reshape_({16, 40, 1, 1});
+    Tensor* t_sp = Tensor::randn({16, 40, 3, 3});
+
+    Tensor* mean = Tensor::zeros({40});
+    Tensor* variance = Tensor::ones({40});
+    Tensor* bn_mean = new Tensor({40});
+    Tensor* bn_var = new Tensor({40});
+
+    Tensor* out_2d = new Tensor({16, 40});
+    Tensor* opa_2d = new Tensor({16, 40});
+    tensorNN::BatchNormForward(t_2d, out_2d, opa_2d, mean, variance, nullptr, nullptr, bn_mean, bn_var, 0.0f, 1e-5f, 1);
+
+    // normalized output: zero mean and unit variance per channel
+    for (int j = 0; j < 40; j++) {
+        float s = 0.0f, s2 = 0.0f;
+        for (int i = 0; i < 16; i++) { s += out_2d->ptr[i*40+j]; s2 += out_2d->ptr[i*40+j]*out_2d->ptr[i*40+j]; }
+        ASSERT_NEAR(s/16, 0.0f, 10e-4f);
+        ASSERT_NEAR(s2/16, 1.0f, 10e-3f);
+    }
+
+    Tensor* out_4d = new Tensor({16, 40, 1, 1});
+    Tensor* opa_4d = new Tensor({16, 40, 1, 1});
+    tensorNN::BatchNormForward(t_4d, out_4d, opa_4d, mean, variance, nullptr, nullptr, bn_mean, bn_var, 0.0f, 1e-5f, 1);
+    out_4d->reshape_({16, 40});
+    ASSERT_TRUE((bool) Tensor::equivalent(out_2d, out_4d, 10e-5f));
+
+    Tensor* out_sp = new Tensor({16, 40, 3, 3});
+    Tensor* opa_sp = new Tensor({16, 40, 3, 3});
+    tensorNN::BatchNormForward(t_sp, out_sp, opa_sp, mean, variance, nullptr, nullptr, bn_mean, bn_var, 0.0f, 1e-5f, 1);
+    ASSERT_NEAR(out_sp->sum(), 0.0f, 10e-2f);
+}
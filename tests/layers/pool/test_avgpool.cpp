@@ -36,8 +36,6 @@ TEST(AvgPoolTestSuite, avgpool_k2x2_s2x2_pad_valid)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -80,8 +78,6 @@ TEST(AvgPoolTestSuite, avgpool_k2x2_s2x2_pad_same)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -124,8 +120,6 @@ TEST(AvgPoolTestSuite, avgpool_k3x3_s1x1_pad_valid)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -170,8 +164,6 @@ TEST(AvgPoolTestSuite, avgpool_k3x3_s1x1_pad_same)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -215,8 +207,6 @@ TEST(AvgPoolTestSuite, avgpool_k3x3_s2x2_pad_valid)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -260,8 +250,6 @@ TEST(AvgPoolTestSuite, avgpool_k3x3_s2x2_pad_same)
     pd->build(t_image);
     pd->ID = Tensor::zeros(pd->I->getShape());
     pd->D = Tensor::ones(pd->O->getShape());
-    pd->indX = new Tensor(pd->O->getShape());
-    pd->indY = new Tensor(pd->O->getShape());
 
     // Forward
     tensorNN::AvgPool2D(pd);
@@ -273,6 +261,60 @@ TEST(AvgPoolTestSuite, avgpool_k3x3_s2x2_pad_same)
 }
 
 
+TEST(AvgPoolTestSuite, avgpool_k3x3_s1x1_pad_same_narrow)
+{
+    // Narrow: the rows have an interior but no column has one
+    auto *ptr_img = new float[4*2]{1, 2, 3, 4, 5, 6, 7, 8};
+    auto* t_image = new Tensor({1, 1, 4, 2}, ptr_img, DEV_CPU);
+
+    auto *ptr_fwrd = new float[4*2]{10/9.0f, 10/9.0f, 21/9.0f, 21/9.0f, 33/9.0f, 33/9.0f, 26/9.0f, 26/9.0f};
+    auto* t_fwrd = new Tensor({1, 1, 4, 2}, ptr_fwrd, DEV_CPU);
+
+    auto *ptr_bwrd = new float[4*2]{4/9.0f, 4/9.0f, 6/9.0f, 6/9.0f, 6/9.0f, 6/9.0f, 4/9.0f, 4/9.0f};
+    auto* t_bwrd = new Tensor({1, 1, 4, 2}, ptr_bwrd, DEV_CPU);
+
+    // Operation
+    auto *pd = new PoolDescriptor({3, 3}, {1, 1}, "same");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    // Forward
+    tensorNN::AvgPool2D(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    tensorNN::AvgPool2D_back(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
+}
+
+TEST(AvgPoolTestSuite, avgpool_k3x3_s1x1_pad_same_short)
+{
+    // Short: the columns have an interior but no row has one
+    auto *ptr_img = new float[2*4]{1, 2, 3, 4, 5, 6, 7, 8};
+    auto* t_image = new Tensor({1, 1, 2, 4}, ptr_img, DEV_CPU);
+
+    auto *ptr_fwrd = new float[2*4]{14/9.0f, 24/9.0f, 30/9.0f, 22/9.0f, 14/9.0f, 24/9.0f, 30/9.0f, 22/9.0f};
+    auto* t_fwrd = new Tensor({1, 1, 2, 4}, ptr_fwrd, DEV_CPU);
+
+    auto *ptr_bwrd = new float[2*4]{4/9.0f, 6/9.0f, 6/9.0f, 4/9.0f, 4/9.0f, 6/9.0f, 6/9.0f, 4/9.0f};
+    auto* t_bwrd = new Tensor({1, 1, 2, 4}, ptr_bwrd, DEV_CPU);
+
+    // Operation
+    auto *pd = new PoolDescriptor({3, 3}, {1, 1}, "same");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    // Forward
+    tensorNN::AvgPool2D(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    tensorNN::AvgPool2D_back(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
+}
+
 #ifdef cGPU
 TEST(MaxPoolTestSuite, avgpool_k2x2_s2x2_pad_valid_gpu)
 {
@@ -285,16 +327,12 @@ TEST(MaxPoolTestSuite, avgpool_k2x2_s2x2_pad_valid_gpu)
     pd_cpu->build(t_cpu);
     pd_cpu->ID = Tensor::zeros(pd_cpu->I->getShape());
     pd_cpu->D = Tensor::ones(pd_cpu->O->getShape());
-    pd_cpu->indX = new Tensor(pd_cpu->O->getShape());
-    pd_cpu->indY = new Tensor(pd_cpu->O->getShape());
 
     // GPU Operation
     auto *pd_gpu = new PoolDescriptor({2, 2}, {2, 2}, "valid");
     pd_gpu->build(t_gpu);
     pd_gpu->ID = Tensor::zeros(pd_gpu->I->getShape(), t_gpu->device);
     pd_gpu->D = Tensor::ones(pd_gpu->O->getShape(), t_gpu->device);
-    pd_gpu->indX = new Tensor(pd_gpu->O->getShape(), t_gpu->device);
-    pd_gpu->indY = new Tensor(pd_gpu->O->getShape(), t_gpu->device);
 
     // Forward
     tensorNN::AvgPool2D(pd_cpu);
@@ -271,6 +271,103 @@ TEST(MaxPoolTestSuite, mpool_k3x3_s2x2_pad_same){
     ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
 }
 
+TEST(MaxPoolTestSuite, mpool_k3x3_s1x1_pad_same_narrow)
+{
+    // Narrow: the rows have an interior but no column has one
+    auto *ptr_img = new float[4*2]{1, 2, 3, 4, 5, 6, 7, 8};
+    auto* t_image = new Tensor({1, 1, 4, 2}, ptr_img, DEV_CPU);
+
+    auto *ptr_fwrd = new float[4*2]{4, 4, 6, 6, 8, 8, 8, 8};
+    auto* t_fwrd = new Tensor({1, 1, 4, 2}, ptr_fwrd, DEV_CPU);
+
+    auto *ptr_bwrd = new float[4*2]{0, 0, 0, 2, 0, 2, 0, 4};
+    auto* t_bwrd = new Tensor({1, 1, 4, 2}, ptr_bwrd, DEV_CPU);
+
+    // Operation
+    auto *pd = new PoolDescriptor({3, 3}, {1, 1}, "same");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+    pd->indX = new Tensor(pd->O->getShape());
+    pd->indY = new Tensor(pd->O->getShape());
+
+    // Forward
+    tensorNN::MPool2D(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    tensorNN::MPool2D_back(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
+}
+
+TEST(MaxPoolTestSuite, mpool_k3x3_s1x1_pad_same_short)
+{
+    // Short: the columns have an interior but no row has one
+    auto *ptr_img = new float[2*4]{1, 2, 3, 4, 5, 6, 7, 8};
+    auto* t_image = new Tensor({1, 1, 2, 4}, ptr_img, DEV_CPU);
+
+    auto *ptr_fwrd = new float[2*4]{6, 7, 8, 8, 6, 7, 8, 8};
+    auto* t_fwrd = new Tensor({1, 1, 2, 4}, ptr_fwrd, DEV_CPU);
+
+    auto *ptr_bwrd = new float[2*4]{0, 0, 0, 0, 0, 2, 2, 4};
+    auto* t_bwrd = new Tensor({1, 1, 2, 4}, ptr_bwrd, DEV_CPU);
+
+    // Operation
+    auto *pd = new PoolDescriptor({3, 3}, {1, 1}, "same");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+    pd->indX = new Tensor(pd->O->getShape());
+    pd->indY = new Tensor(pd->O->getShape());
+
+    // Forward
+    tensorNN::MPool2D(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    tensorNN::MPool2D_back(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
+}
+
+TEST(MaxPoolTestSuite, mpool_k2x2_s2x2_pad_valid_negative)
+{
+    // Image
+    auto *ptr_img = new float[4*4]{ -1,  -2,  -3,  -4,
+                                    -5,  -6,  -7,  -8,
+                                    -9, -10, -11, -12,
+                                   -13, -14, -15, -16};
+    auto* t_image = new Tensor({1, 1, 4, 4}, ptr_img, DEV_CPU);
+
+
+    // Forward
+    auto *ptr_fwrd = new float[2*2]{-1, -3,
+                                    -9, -11};
+    auto* t_fwrd = new Tensor({1, 1, 2, 2}, ptr_fwrd, DEV_CPU);
+
+
+    // backward
+    auto *ptr_bwrd = new float[4*4]{1, 0, 1, 0,
+                                    0, 0, 0, 0,
+                                    1, 0, 1, 0,
+                                    0, 0, 0, 0};
+    auto* t_bwrd = new Tensor({1, 1, 4, 4}, ptr_bwrd, DEV_CPU);
+
+    // Operation
+    auto *pd = new PoolDescriptor({2, 2}, {2, 2}, "valid");
+    pd->build(t_image);
+    pd->ID = Tensor::zeros(pd->I->getShape());
+    pd->D = Tensor::ones(pd->O->getShape());
+
+    // Forward
+    tensorNN::MPool2D(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_fwrd, pd->O, 10e-5f));
+
+    // Backward
+    tensorNN::MPool2D_back(pd);
+    ASSERT_TRUE((bool) Tensor::equivalent(t_bwrd, pd->ID, 10e-5f));
+}
+
+
 #ifdef cGPU
 TEST(MaxPoolTestSuite, mpool_k2x2_s2x2_pad_valid_gpu)
 {
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/recurrent/layer_recurrent.h"
+
+
+// Two unrolled steps of an LSTM, as the recurrent nets build them
+struct LSTMSteps {
+    LInput *x1, *x2;
+    LLSTM *s1, *s2;
+};
+
+static void per_gate(LLSTM *l){
+    // Drop the workspaces of the fused kernels: the layer runs the per-gate path
+    delete l->gates;
+    delete l->sh;
+    l->gates = nullptr;
+}
+
+static LSTMSteps lstm_steps(Tensor *a, Tensor *b, bool packed){
+    LSTMSteps s;
+    s.x1 = new LInput(a->clone(), "x1", DEV_CPU, 0);
+    s.x2 = new LInput(b->clone(), "x2", DEV_CPU, 0);
+    s.s1 = new LLSTM({s.x1}, 6, false, false, "lstm", DEV_CPU, 0);
+    s.s2 = (LLSTM *) s.s1->share(1, a->shape[0], {s.x2, s.s1});
+    if (!packed) {
+        per_gate(s.s1);
+        per_gate(s.s2);
+    }
+    for (Layer *l : vector<Layer *>{s.x1, s.x2, s.s1, s.s2}) l->mem_delta();
+    s.s1->zeroGrads();
+    return s;
+}
+
+static void run(LSTMSteps &s, Tensor *d){
+    s.s1->forward();
+    s.s2->forward();
+    Tensor::copy(d, s.s2->delta_h);
+    s.s2->backward();
+    s.s1->backward();
+}
+
+
+TEST(LSTMTestSuite, packed_vs_per_gate){
+    Tensor *a = Tensor::randn({3, 5});
+    Tensor *b = Tensor::randn({3, 5});
+    Tensor *d = Tensor::randn({3, 6});
+
+    LSTMSteps p = lstm_steps(a, b, true);
+    LSTMSteps r = lstm_steps(a, b, false);
+    for (Tensor *w : p.s1->params) w->rand_normal(0.0f, 0.5f);
+    p.s1->copy(r.s1);
+
+    run(p, d);
+    run(r, d);
+
+    // Forward: outputs and cells of both steps
+    ASSERT_TRUE((bool) Tensor::equivalent(p.s1->state_h, r.s1->state_h, 1e-5f));
+    ASSERT_TRUE((bool) Tensor::equivalent(p.s2->state_h, r.s2->state_h, 1e-5f));
+    ASSERT_TRUE((bool) Tensor::equivalent(p.s2->state_c, r.s2->state_c, 1e-5f));
+
+    // Backward: deltas of the inputs and gradients (shared by the steps)
+    ASSERT_TRUE((bool) Tensor::equivalent(p.x1->delta, r.x1->delta, 1e-5f));
+    ASSERT_TRUE((bool) Tensor::equivalent(p.x2->delta, r.x2->delta, 1e-5f));
+    for (int i = 0; i < p.s1->gradients.size(); i++)
+        ASSERT_TRUE((bool) Tensor::equivalent(p.s1->gradients[i], r.s1->gradients[i], 1e-5f));
+}
+
+TEST(LSTMTestSuite, packed_weights_follow_params){
+    Tensor *a = Tensor::randn({3, 5});
+    Tensor *b = Tensor::randn({3, 5});
+    Tensor *d = Tensor::randn({3, 6});
+
+    LSTMSteps p = lstm_steps(a, b, true);
+    LSTMSteps r = lstm_steps(a, b, false);
+    for (Tensor *w : p.s1->params) w->rand_normal(0.0f, 0.5f);
+    p.s1->copy(r.s1);
+    run(p, d);
+    run(r, d);
+
+    // New weights outside a net forward: a direct forward of a step packs them again
+    for (Tensor *w : r.s1->params) w->rand_normal(0.0f, 0.5f);
+    r.s1->copy(p.s1);
+    p.s2->forward();
+    r.s2->forward();
+    ASSERT_TRUE((bool) Tensor::equivalent(p.s2->state_h, r.s2->state_h, 1e-5f));
+}
+
+TEST(LSTMTestSuite, packed_weights_follow_copies){
+    Tensor *a = Tensor::randn({3, 5});
+    Tensor *b = Tensor::randn({3, 5});
+    Tensor *d = Tensor::randn({3, 6});
+
+    LSTMSteps p = lstm_steps(a, b, true);
+    LSTMSteps r = lstm_steps(a, b, false);
+    for (Tensor *w : p.s1->params) w->rand_normal(0.0f, 0.5f);
+    p.s1->copy(r.s1);
+    run(p, d);
+    run(r, d);
+
+    // Params overwritten with Tensor::copy (as load, copyParam or the ONNX
+    // import do), without params_changed: the packed weights follow too
+    for (Tensor *w : r.s1->params) w->rand_normal(0.0f, 0.5f);
+    for (int i = 0; i < r.s1->params.size(); i++) Tensor::copy(r.s1->params[i], p.s1->params[i]);
+    p.s2->forward();
+    r.s2->forward();
+    ASSERT_TRUE((bool) Tensor::equivalent(p.s2->state_h, r.s2->state_h, 1e-5f));
+}
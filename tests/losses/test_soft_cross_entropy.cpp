@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/tensor/nn/tensor_nn.h"
+#include "eddl/losses/loss.h"
+
+
+TEST(LossTestSuite, soft_cent_fused_vs_unfused){
+    // Softmax outputs and one-hot targets
+    Tensor *Z = Tensor::randn({32, 10});
+    Tensor *Y = Tensor::empty({32, 10});
+    tensorNN::Softmax(Z, Y);
+    Tensor *T = Tensor::zeros({32, 10});
+    for (int i = 0; i < 32; i++) T->ptr[i * 10 + (i * 7) % 10] = 1.0f;
+
+    auto *loss = new LSoftCrossEntropy();
+    Tensor *D1 = Tensor::zeros({32, 10});
+    Tensor *D2 = Tensor::zeros({32, 10});
+
+    float f1 = loss->value(T, Y);
+    loss->delta(T, Y, D1);
+    float f2 = loss->value_delta(T, Y, D2);
+
+    ASSERT_NEAR(f1, f2, 1e-5 * std::fabs(f1));
+    ASSERT_TRUE((bool) Tensor::equivalent(D1, D2, 1e-7f));
+
+    delete loss;
+    delete Z; delete Y; delete T;
+    delete D1; delete D2;
+}
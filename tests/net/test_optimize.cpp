@@ -0,0 +1,316 @@
+#include <gtest/gtest.h>
+
+#include "eddl/apis/eddl.h"
+#include "eddl/layers/normalization/layer_normalization.h"
+#include "eddl/layers/core/layer_core.h"
+#include "eddl/layers/merge/layer_merge.h"
+#include "eddl/serialization/onnx/eddl_onnx.h"
+
+
+using namespace eddl;
+
+
+TEST(NetTestSuite, optimize_inference_same_output){
+    layer in = Input({3, 8, 8});
+    layer bn1 = BatchNormalization(Conv(in, 4, {3, 3}), 0.9f, 0.001f, true);
+    layer l = ReLu(bn1);
+    l = Reshape(l, {-1});
+    layer bn2 = BatchNormalization(Dense(l, 6, false), 0.9f, 0.001f, false);
+    l = Sigmoid(bn2);
+    layer out = Softmax(Dense(l, 3));
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    // Non trivial running statistics
+    for (auto *b : {(LBatchNorm *)bn1, (LBatchNorm *)bn2}) {
+        b->mean->rand_uniform(1.0f);
+        b->variance->rand_uniform(1.0f);
+        b->variance->add_(0.5f);
+        if (b->affine) { b->bn_g->rand_uniform(1.0f); b->bn_b->rand_uniform(1.0f); }
+    }
+
+    Tensor *x = Tensor::randn({4, 3, 8, 8});
+    Tensor *ref = predict(net, {x})[0]->clone();
+
+    optimize_inference(net);
+    ASSERT_EQ(net->layers.size(), 6);  // input, conv, reshape, dense, dense, softmax
+
+    Tensor *y = predict(net, {x})[0];
+    ASSERT_TRUE((bool) Tensor::equivalent(ref, y, 10e-5f));
+
+    // The folded layers are not described by the saved or exported net
+    ASSERT_THROW(save(net, "/tmp/eddl_test_optimized.bin"), std::runtime_error);
+    ASSERT_THROW(save_net_to_onnx_file(net, "/tmp/eddl_test_optimized.onnx"), std::runtime_error);
+}
+
+
+TEST(NetTestSuite, quantize_close_output){
+    set_seed(1234);  // the error bounds hold for most, not all, random nets
+    layer in = Input({3, 9, 9});
+    layer l = ReLu(Conv(in, 5, {3, 3}, {2, 2}, "same"));
+    l = Conv(l, 6, {3, 3});
+    l = Reshape(l, {-1});
+    layer out = Dense(ReLu(Dense(l, 7)), 3);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({4, 3, 9, 9});
+    Tensor *ref = predict(net, {x})[0]->clone();
+
+    quantize(net, {x});
+    ASSERT_NE(((LDense *)out)->qd, nullptr);
+    ASSERT_EQ(((LDense *)out)->W->ptr, nullptr);  // float weights freed
+
+    // int8 weights and inputs: about 1% of the output range
+    Tensor *y = predict(net, {x})[0];
+    float range = ref->max() - ref->min();
+    for (int i = 0; i < ref->size; i++)
+        ASSERT_NEAR(ref->ptr[i], y->ptr[i], 0.03f * range);
+}
+
+
+// With or without the float weights, the folded BatchNorms are applied to the
+// quantized ones
+static void quantize_then_fold(const string& dtype, bool keep_float){
+    set_seed(1234);  // the error bounds hold for most, not all, random nets
+    layer in = Input({3, 8, 8});
+    layer bn1 = BatchNormalization(Conv(in, 4, {3, 3}), 0.9f, 0.001f, true);
+    layer l = ReLu(bn1);
+    l = Reshape(l, {-1});
+    layer bn2 = BatchNormalization(Dense(l, 6, false), 0.9f, 0.001f, false);
+    layer out = Dense(Sigmoid(bn2), 3);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    for (auto *b : {(LBatchNorm *)bn1, (LBatchNorm *)bn2}) {
+        b->mean->rand_uniform(1.0f);
+        b->variance->rand_uniform(1.0f);
+        b->variance->add_(0.5f);
+        if (b->affine) { b->bn_g->rand_uniform(1.0f); b->bn_g->sub_(0.5f); b->bn_b->rand_uniform(1.0f); }  // some negative scales
+    }
+
+    Tensor *x = Tensor::randn({4, 3, 8, 8});
+    Tensor *ref = predict(net, {x})[0]->clone();
+
+    // The BatchNorms folded into already quantized layers are not lost
+    quantize(net, {x}, dtype, keep_float);
+    ASSERT_EQ(((LDense *)out)->W->ptr != nullptr, keep_float);
+    optimize_inference(net);
+    ASSERT_EQ(net->layers.size(), 5);  // input, conv, reshape, dense, dense
+
+    Tensor *y = predict(net, {x})[0];
+    float range = ref->max() - ref->min();
+    for (int i = 0; i < ref->size; i++)
+        ASSERT_NEAR(ref->ptr[i], y->ptr[i], 0.03f * range);
+}
+
+TEST(NetTestSuite, quantize_then_optimize_inference){
+    quantize_then_fold("int8", false);
+    quantize_then_fold("int8", true);
+    quantize_then_fold("float16", false);
+}
+
+
+TEST(NetTestSuite, plan_memory_then_quantize){
+    // The calibration sees the inputs of every layer, not what the arena
+    // holds at the end of the forward
+    model nets[2];
+    for (int k = 0; k < 2; k++) {
+        layer in = Input({3, 16, 16});
+        layer l = ReLu(Conv(in, 8, {3, 3}));
+        for (int i = 0; i < 4; i++) l = ReLu(Conv(l, 8, {3, 3}));
+        layer out = Dense(Reshape(l, {-1}), 10);
+        nets[k] = Model({in}, {out});
+        build(nets[k], sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+    }
+    for (int i = 0; i < nets[0]->layers.size(); i++) nets[0]->layers[i]->copy(nets[1]->layers[i]);
+
+    Tensor *x = Tensor::randn({4, 3, 16, 16});
+    plan_memory(nets[0]);
+    quantize(nets[0], {x});
+    quantize(nets[1], {x});
+    ASSERT_TRUE(nets[0]->isplanned);
+    ASSERT_NE(nets[0]->arena, nullptr);
+
+    Tensor *ref = predict(nets[1], {x})[0]->clone();
+    ASSERT_TRUE((bool) Tensor::equivalent(ref, predict(nets[0], {x})[0], 10e-5f));
+}
+
+
+TEST(NetTestSuite, quantize_half_close_output){
+    set_seed(1234);  // the error bounds hold for most, not all, random nets
+    layer in = Input({3, 9, 9});
+    layer l = ReLu(Conv(in, 5, {3, 3}, {2, 2}, "same"));
+    l = Reshape(l, {-1});
+    layer out = Dense(ReLu(Dense(l, 7)), 3);
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({4, 3, 9, 9});
+    Tensor *ref = predict(net, {x})[0]->clone();
+
+    // no calibration, the inputs stay in float
+    quantize(net, {}, "float16");
+    ASSERT_NE(((LDense *)out)->qd, nullptr);
+
+    // float16 weights, float accumulation
+    Tensor *y = predict(net, {x})[0];
+    float range = ref->max() - ref->min();
+    for (int i = 0; i < ref->size; i++)
+        ASSERT_NEAR(ref->ptr[i], y->ptr[i], 2e-3f * range);
+}
+
+
+// Output and gradients of a training step
+static vector<Tensor *> train_step(model net, Tensor *x, Tensor *y){
+    vector<Tensor *> r;
+    forward(net, {x});
+    r.push_back(net->lout[0]->output->clone());
+    zeroGrads(net);
+    backward(net, {y});
+    for (auto *l : net->layers) for (auto *g : l->gradients) r.push_back(g->clone());
+    return r;
+}
+
+TEST(NetTestSuite, inplace_concat_same_output){
+    for (string mem : {"full_mem", "low_mem"}) {
+        for (int bs : {1, 2}) {
+            layer in = Input({3, 8, 8});
+            layer c0 = Conv(in, 4, {3, 3});
+            layer x1 = Concat({c0, ReLu(Conv(c0, 3, {3, 3}))});
+            layer x2 = Concat({x1, Conv(BatchNormalization(x1, 0.9f, 0.001f, true), 2, {3, 3})});
+            layer x3 = Concat({ReLu(Conv(x2, 2, {1, 1})), x2});
+            layer out = Dense(Reshape(x3, {-1}), 5);
+            model net = Model({in}, {out});
+            build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1, mem), false);
+            net->resize(bs);
+            net->setmode(TSMODE);
+
+            Tensor *x = Tensor::randn({bs, 3, 8, 8});
+            Tensor *y = Tensor::randn({bs, 5});
+            vector<Tensor *> ref = train_step(net, x, y);
+
+            inplace_concat(net);
+            // Any parent at batch 1, otherwise only the convolutions that feed
+            // nothing else write strided
+            for (auto *c : {(LConcat *)x1, (LConcat *)x2, (LConcat *)x3}) {
+                ASSERT_TRUE(c->inplace);
+                ASSERT_EQ(c->aliased, bs == 1);
+            }
+            ASSERT_EQ(((LConcat *)x2)->sliced, vector<bool>({bs == 1, true}));
+            if (bs == 1) {
+                Tensor *o = x3->output;
+                for (auto *p : {c0, x1->parent[1], x2->parent[1], x3->parent[0]})
+                    ASSERT_TRUE((p->output->ptr >= o->ptr) && (p->output->ptr < o->ptr + o->size));
+            }
+
+            vector<Tensor *> got = train_step(net, x, y);
+            for (int i = 0; i < ref.size(); i++) {
+                ASSERT_TRUE((bool) Tensor::equivalent(ref[i], got[i], 10e-5f));
+                delete ref[i];
+                delete got[i];
+            }
+            delete x;
+            delete y;
+        }
+    }
+}
+
+TEST(NetTestSuite, inplace_concat_strided_same_output){
+    // U-Net like: both branches are convolutions, so the concat does no copies
+    // at any batch size, also after resizing
+    for (string mem : {"full_mem", "mid_mem", "low_mem"}) {
+        model nets[2];
+        layer cs[2];
+        for (int k = 0; k < 2; k++) {
+            layer in = Input({3, 8, 8});
+            layer l = ReLu(Conv(in, 4, {3, 3}));
+            cs[k] = Concat({Conv(l, 3, {3, 3}), Conv(l, 2, {1, 1})});
+            layer out = Dense(Reshape(Conv(cs[k], 2, {3, 3}), {-1}), 5);
+            nets[k] = Model({in}, {out});
+            build(nets[k], sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1, mem));
+            nets[k]->setmode(TSMODE);
+        }
+        for (int i = 0; i < nets[0]->layers.size(); i++) nets[0]->layers[i]->copy(nets[1]->layers[i]);
+        inplace_concat(nets[1]);
+
+        for (int bs : {3, 1, 4}) {
+            Tensor *x = Tensor::randn({bs, 3, 8, 8});
+            Tensor *y = Tensor::randn({bs, 5});
+            nets[0]->resize(bs);
+            nets[1]->resize(bs);
+            vector<Tensor *> ref = train_step(nets[0], x, y);
+            vector<Tensor *> got = train_step(nets[1], x, y);
+
+            ASSERT_TRUE(((LConcat *)cs[1])->aliased);
+            ASSERT_EQ(cs[1]->parent[1]->output->ptr, cs[1]->output->ptr + 3 * 8 * 8);
+            for (int i = 0; i < ref.size(); i++) {
+                ASSERT_TRUE((bool) Tensor::equivalent(ref[i], got[i], 10e-5f));
+                delete ref[i];
+                delete got[i];
+            }
+            delete x;
+            delete y;
+        }
+        delete nets[0];
+        delete nets[1];
+    }
+}
+
+TEST(NetTestSuite, resize_same_gradients){
+    // The deltas follow the batch (1 -> 4 -> 1), with and without keeping them
+    for (string mem : {"full_mem", "mid_mem", "low_mem"}) {
+        layer in = Input({3, 8, 8});
+        layer c0 = Conv(in, 4, {3, 3});
+        layer x1 = Concat({c0, ReLu(Conv(c0, 3, {3, 3}))});
+        layer x2 = Concat({x1, Conv(BatchNormalization(x1, 0.9f, 0.001f, true), 2, {3, 3})});
+        layer out = Dense(Reshape(x2, {-1}), 5);
+        model net = Model({in}, {out});
+        build(net, sgd(0.01f), {"mse"}, {"mse"}, CS_CPU(1, mem), false);
+        net->setmode(TSMODE);
+
+        vector<vector<Tensor *>> steps;
+        for (int bs : {1, 4, 4, 1}) {
+            net->resize(bs);
+            Tensor *x = Tensor::ones({bs, 3, 8, 8});
+            Tensor *y = Tensor::ones({bs, 5});
+            steps.push_back(train_step(net, x, y));
+            delete x;
+            delete y;
+        }
+        for (auto pair : {make_pair(0, 3), make_pair(1, 2)}) {
+            vector<Tensor *> &ref = steps[pair.first], &got = steps[pair.second];
+            for (int i = 0; i < ref.size(); i++) ASSERT_TRUE((bool) Tensor::equivalent(ref[i], got[i], 10e-5f));
+        }
+        for (auto &st : steps) for (auto *t : st) delete t;
+    }
+}
+
+TEST(NetTestSuite, plan_memory_same_output){
+    layer in = Input({3, 16, 16});
+    layer l = ReLu(Conv(in, 8, {3, 3}));
+    vector<Layer *> relus;
+    for (int i = 0; i < 8; i++) {
+        layer c = Conv(l, 8, {3, 3});
+        l = (i % 2) ? Add({l, c}) : ReLu(c);
+        if (!(i % 2)) relus.push_back(l);
+    }
+    l = Dropout(l, 0.5f);
+    layer out = Softmax(Dense(Reshape(l, {-1}), 10));
+    model net = Model({in}, {out});
+    build(net, sgd(0.01f), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(1));
+
+    Tensor *x = Tensor::randn({4, 3, 16, 16});
+    Tensor *x2 = Tensor::randn({2, 3, 16, 16});
+    Tensor *ref = predict(net, {x})[0]->clone();
+    Tensor *ref2 = predict(net, {x2})[0]->clone();
+
+    plan_memory(net);
+    ASSERT_TRUE((bool) Tensor::equivalent(ref, predict(net, {x})[0], 10e-5f));
+    ASSERT_TRUE((bool) Tensor::equivalent(ref2, predict(net, {x2})[0], 10e-5f));
+
+    // At most three outputs alive (Add), the activations work in place
+    ASSERT_LE(net->arena_size, 3 * 2 * 8 * 16 * 16);
+    for (auto *r : relus) ASSERT_EQ(r->output->ptr, r->parent[0]->output->ptr);
+    ASSERT_TRUE(net->isinference);
+}
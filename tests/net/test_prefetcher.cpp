@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+TEST(NetTestSuite, prefetcher_epochs){
+    // Sample i is {i} (input) and {-i} (target)
+    Tensor *x = Tensor::zeros({10, 1});
+    Tensor *y = Tensor::zeros({10, 1});
+    for(int i=0; i<10; i++){ x->ptr[i] = i; y->ptr[i] = -i; }
+
+    // In order: 3 batches per epoch, the last partial one is dropped
+    dataloader l = prefetch({x}, {y}, 3, false);
+    vector<Tensor *> bx, by;
+    for(int e=0; e<2; e++) {
+        for(int b=0; b<3; b++) {
+            ASSERT_TRUE(next_batch(l, bx, by));
+            for(int k=0; k<3; k++) {
+                ASSERT_EQ(bx[0]->ptr[k], b*3 + k);
+                ASSERT_EQ(by[0]->ptr[k], -(b*3 + k));
+            }
+        }
+        ASSERT_FALSE(next_batch(l, bx, by));
+    }
+    delete l;
+
+    // Shuffled and transformed: every sample at most once per epoch
+    l = prefetch({x}, {y}, 5, true, 3);
+    l->transform = [](vector<Tensor *> &in, vector<Tensor *> &out) { in[0]->add_(100.0f); };
+    for(int e=0; e<3; e++) {
+        std::set<int> seen;
+        while(next_batch(l, bx, by)) {
+            for(int k=0; k<5; k++) {
+                ASSERT_EQ(bx[0]->ptr[k] - 100.0f, -by[0]->ptr[k]);
+                seen.insert((int)-by[0]->ptr[k]);
+            }
+        }
+        ASSERT_EQ(seen.size(), 10);
+    }
+    ASSERT_GE(l->stall_time, 0.0);
+    delete l;
+
+    delete x;
+    delete y;
+}
+
+
+TEST(NetTestSuite, prefetcher_mapped_shards){
+    // Two shards of 4 and 6 samples
+    Tensor *x1 = Tensor::range(0, 7, 1); x1->reshape_({4, 2});
+    Tensor *x2 = Tensor::range(8, 19, 1); x2->reshape_({6, 2});
+    x1->save("/tmp/eddl_test_shard1.bin");
+    x2->save("/tmp/eddl_test_shard2.bin", "bin", "float32", true);
+
+    // By default the format is unchanged: ndim, shape and data
+    std::ifstream f("/tmp/eddl_test_shard1.bin", std::ios::binary | std::ios::ate);
+    ASSERT_EQ((size_t) f.tellg(), (1 + 2 + 8) * sizeof(int));
+    f.close();
+    Tensor *m = Tensor::load_mapped("/tmp/eddl_test_shard1.bin");
+    ASSERT_TRUE(Tensor::equivalent(m, x1, 10e-6));
+    delete m;
+
+    // With a padded header the mapped data is aligned
+    m = Tensor::load_mapped("/tmp/eddl_test_shard2.bin");
+    ASSERT_TRUE(Tensor::equivalent(m, x2, 10e-6));
+    ASSERT_EQ((uintptr_t) m->ptr % 64, 0);
+    delete m;
+
+    // And the file still loads as any bin file
+    Tensor *t = Tensor::load("/tmp/eddl_test_shard2.bin");
+    ASSERT_TRUE(Tensor::equivalent(t, x2, 10e-6));
+    delete t;
+
+    Dataset *d = open_dataset({"/tmp/eddl_test_shard1.bin", "/tmp/eddl_test_shard2.bin"});
+    ASSERT_EQ(d->num_samples, 10);
+    ASSERT_TRUE(d->shape == vector<int>({10, 2}));
+
+    Tensor *b = new Tensor({3, 2});
+    d->select({9, 0, 4}, b);
+    ASSERT_EQ(b->ptr[0], 18); ASSERT_EQ(b->ptr[1], 19);
+    ASSERT_EQ(b->ptr[2], 0);  ASSERT_EQ(b->ptr[3], 1);
+    ASSERT_EQ(b->ptr[4], 8);  ASSERT_EQ(b->ptr[5], 9);
+
+    // Batches across the shards
+    dataloader l = prefetch({d}, {}, 5, false);
+    vector<Tensor *> bx, by;
+    ASSERT_TRUE(next_batch(l, bx, by));
+    ASSERT_TRUE(next_batch(l, bx, by));
+    ASSERT_EQ(bx[0]->ptr[0], 10);
+    ASSERT_FALSE(next_batch(l, bx, by));
+    delete l;
+
+    delete b;
+    delete d;
+    delete x1;
+    delete x2;
+    std::remove("/tmp/eddl_test_shard1.bin");
+    std::remove("/tmp/eddl_test_shard2.bin");
+}
+
+
+TEST(NetTestSuite, fit_same_as_train_batch){
+    // fit hands the prefetched batches to the inputs and targets; the same
+    // batches through train_batch give the same weights
+    Tensor *x = Tensor::randn({20, 4});
+    Tensor *y = Tensor::randn({20, 2});
+    model nets[2];
+    for (int k = 0; k < 2; k++) {
+        layer in = Input({4});
+        layer out = Dense(ReLu(Dense(in, 8)), 2);
+        nets[k] = Model({in}, {out});
+        build(nets[k], sgd(0.01f, 0.9f), {"mse"}, {"mse"}, CS_CPU(1));
+    }
+    for (int i = 0; i < nets[0]->layers.size(); i++) nets[0]->layers[i]->copy(nets[1]->layers[i]);
+
+    set_seed(7);
+    fit(nets[0], {x}, {y}, 5, 2);
+
+    set_seed(7);
+    nets[1]->resize(5);
+    Prefetcher loader({x}, {y}, 5, true);
+    vector<int> sind = {0, 1, 2, 3, 4};
+    vector<Tensor *> bx, by;
+    for (int e = 0; e < 2; e++)
+        while (loader.next(bx, by)) nets[1]->train_batch(bx, by, sind);
+
+    for (int i = 0; i < nets[0]->layers.size(); i++)
+        for (int j = 0; j < nets[0]->layers[i]->params.size(); j++)
+            ASSERT_TRUE((bool) Tensor::equivalent(nets[0]->layers[i]->params[j], nets[1]->layers[i]->params[j], 1e-5f));
+
+    // The inputs have their own data again
+    ASSERT_FALSE(nets[0]->lin[0]->input->isshared);
+    ASSERT_FALSE(nets[0]->lout[0]->target->isshared);
+
+    delete x;
+    delete y;
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <stdexcept>
+#include <map>
+#include <mutex>
+
+#include "eddl/net/net.h"
+
+
+// The workers receive a struct whose first member is their snet
+static std::mutex snet_mtx;
+static std::map<Net *, pthread_t> snet_threads;
+static Net *snet_fail = nullptr;
+
+static void *record_thread_t(void *t) {
+    Net *net = *(Net **) t;
+    if (net == snet_fail) throw std::runtime_error("snet failed");
+    std::lock_guard<std::mutex> lock(snet_mtx);
+    snet_threads[net] = pthread_self();
+    return nullptr;
+}
+
+static Net *snets_net(int n) {
+    Net *net = new Net();
+    for (int i = 0; i < n; i++) net->snets.push_back(new Net());
+    return net;
+}
+
+
+TEST(NetTestSuite, snets_workers_reused){
+    Net *net = snets_net(3);
+
+    net->run_snets(record_thread_t);
+    ASSERT_NE(net->pool, nullptr);
+    ASSERT_EQ(snet_threads.size(), 3);
+    std::map<Net *, pthread_t> first = snet_threads;
+
+    // The same worker for each snet, and not the caller
+    for (int k = 0; k < 5; k++) {
+        snet_threads.clear();
+        net->run_snets(record_thread_t);
+        ASSERT_EQ(snet_threads.size(), 3);
+        for (auto *s : net->snets) {
+            ASSERT_TRUE(pthread_equal(snet_threads[s], first[s]));
+            ASSERT_FALSE(pthread_equal(snet_threads[s], pthread_self()));
+        }
+    }
+
+    // A different number of snets gets new workers
+    net->snets.push_back(new Net());
+    snet_threads.clear();
+    net->run_snets(record_thread_t);
+    ASSERT_EQ(snet_threads.size(), 4);
+
+    net->stop_snets();
+    ASSERT_EQ(net->pool, nullptr);
+    for (auto *s : net->snets) delete s;
+    delete net;
+}
+
+TEST(NetTestSuite, snets_single_in_caller){
+    Net *net = snets_net(1);
+
+    snet_threads.clear();
+    net->run_snets(record_thread_t);
+    ASSERT_EQ(net->pool, nullptr);
+    ASSERT_TRUE(pthread_equal(snet_threads[net->snets[0]], pthread_self()));
+    delete net->snets[0];
+    delete net;
+}
+
+TEST(NetTestSuite, snets_error_rethrown){
+    Net *net = snets_net(2);
+
+    snet_fail = net->snets[1];
+    ASSERT_THROW(net->run_snets(record_thread_t), std::runtime_error);
+
+    // The workers are still there after the error, and released on stop
+    snet_fail = nullptr;
+    snet_threads.clear();
+    net->run_snets(record_thread_t);
+    ASSERT_EQ(snet_threads.size(), 2);
+
+    net->stop_snets();
+    ASSERT_EQ(net->pool, nullptr);
+    net->run_snets(record_thread_t);  // and created again
+    ASSERT_NE(net->pool, nullptr);
+    for (auto *s : net->snets) delete s;
+    delete net;  // joins the workers
+}
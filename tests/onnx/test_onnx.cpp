@@ -129,3 +129,120 @@ TEST(ONNXTestSuite, onnx_import){
 
 }
 
+
+TEST(ONNXTestSuite, onnx_import_half){
+    // Generate random name
+    int rdn_name = dist6(mt);
+    string fname = "onnx_net_" + to_string(rdn_name) + ".onnx";
+
+    Net* net_export = get_network();
+    build(net_export, sgd(0.01), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(), true);
+    net_export->resize(1);
+
+    // Export the weights as float16 (cast to float inside the graph)
+    save_net_to_onnx_file(net_export, fname, "float16");
+
+    // bfloat16 needs opset 13
+    ASSERT_THROW(save_net_to_onnx_file(net_export, fname + ".bf16", "bfloat16"), std::runtime_error);
+
+    Net* net_import = import_net_from_onnx_file(fname);
+    build(net_import, sgd(0.01), {"soft_cross_entropy"}, {"categorical_accuracy"}, CS_CPU(), false);
+    net_import->resize(1);
+
+    // Delete file
+    int hasFailed = std::remove(fname.c_str());
+    if(hasFailed) { cout << "Error deleting file: " << fname << endl; }
+
+    // Same layers, weights (below 1) rounded to 11 bits of mantissa
+    ASSERT_EQ(net_export->layers.size(), net_import->layers.size());
+    for(int i=0; i<net_export->layers.size(); i++){
+        ASSERT_EQ(net_export->layers[i]->params.size(), net_import->layers[i]->params.size());
+        for(int j=0; j<net_export->layers[i]->params.size(); j++){
+            ASSERT_TRUE(Tensor::equivalent(net_export->layers[i]->params[j], net_import->layers[i]->params[j], 4e-3f));
+        }
+    }
+}
+
+
+TEST(ONNXTestSuite, onnx_import_grouped_conv){
+    // Generate random name
+    int rdn_name = dist6(mt);
+    string fname = "onnx_net_" + to_string(rdn_name) + ".onnx";
+
+    // Grouped and dilated, then depthwise
+    layer in = Input({4, 12, 12});
+    layer l = Conv(in, 8, {3, 3}, {1, 1}, "same", true, 2, {2, 2});
+    layer out = DepthwiseConv2D(l, {3, 3}, {2, 2}, "same", true);
+    Net* net_export = Model({in}, {out});
+    build(net_export, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), true);
+    net_export->resize(2);
+
+    save_net_to_onnx_file(net_export, fname);
+
+    Net* net_import = import_net_from_onnx_file(fname);
+    build(net_import, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), false);
+    net_import->resize(2);
+
+    // Delete file
+    int hasFailed = std::remove(fname.c_str());
+    if(hasFailed) { cout << "Error deleting file: " << fname << endl; }
+
+    // Same groups and dilations, so the same outputs
+    ASSERT_EQ(net_export->layers.size(), net_import->layers.size());
+    for(int i=0; i<net_export->layers.size(); i++){
+        auto *c_exp = dynamic_cast<LConv *>(net_export->layers[i]);
+        auto *c_imp = dynamic_cast<LConv *>(net_import->layers[i]);
+        if (c_exp == nullptr) continue;
+        ASSERT_TRUE(c_imp != nullptr);
+        ASSERT_EQ(c_exp->cd->groups, c_imp->cd->groups);
+        ASSERT_EQ(c_exp->cd->dr, c_imp->cd->dr);
+        ASSERT_EQ(c_exp->cd->dc, c_imp->cd->dc);
+    }
+
+    Tensor* x = Tensor::randn({2, 4, 12, 12});
+    net_export->forward({x});
+    net_import->forward({x});
+    ASSERT_TRUE(Tensor::equivalent(net_export->lout[0]->output, net_import->lout[0]->output, 10e-4f));
+    delete x;
+}
+
+TEST(ONNXTestSuite, onnx_import_transposed_conv){
+    // Generate random name
+    int rdn_name = dist6(mt);
+    string fname = "onnx_net_" + to_string(rdn_name) + ".onnx";
+
+    // Output padding, then "same" upsampling without bias
+    layer in = Input({4, 6, 6});
+    layer l = ConvT(in, 3, {3, 3}, {1, 1}, "valid", {1, 1}, {2, 2});
+    layer out = ConvT(l, 2, {4, 4}, {0, 0}, "same", {1, 1}, {2, 2}, false);
+    Net* net_export = Model({in}, {out});
+    build(net_export, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), true);
+    net_export->resize(2);
+    ASSERT_EQ(out->output->shape, vector<int>({2, 2, 28, 28}));
+
+    save_net_to_onnx_file(net_export, fname);
+
+    Net* net_import = import_net_from_onnx_file(fname);
+    build(net_import, sgd(0.01), {"mse"}, {"mse"}, CS_CPU(), false);
+    net_import->resize(2);
+
+    // Delete file
+    int hasFailed = std::remove(fname.c_str());
+    if(hasFailed) { cout << "Error deleting file: " << fname << endl; }
+
+    ASSERT_EQ(net_export->layers.size(), net_import->layers.size());
+    for(int i=0; i<net_export->layers.size(); i++){
+        auto *c_exp = dynamic_cast<LConvT *>(net_export->layers[i]);
+        auto *c_imp = dynamic_cast<LConvT *>(net_import->layers[i]);
+        if (c_exp == nullptr) continue;
+        ASSERT_TRUE(c_imp != nullptr);
+        ASSERT_EQ(c_exp->output_padding, c_imp->output_padding);
+        ASSERT_EQ(c_exp->use_bias, c_imp->use_bias);
+    }
+
+    Tensor* x = Tensor::randn({2, 4, 6, 6});
+    net_export->forward({x});
+    net_import->forward({x});
+    ASSERT_TRUE(Tensor::equivalent(net_export->lout[0]->output, net_import->lout[0]->output, 10e-4f));
+    delete x;
+}
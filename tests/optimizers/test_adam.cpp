@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include "eddl/apis/eddl.h"
+
+
+using namespace eddl;
+
+
+// Adam step as in the paper (and the multi-pass path for other devices)
+static void adam_reference(vector<double> &p, vector<double> &m, vector<double> &v, const float *g, int t,
+                           float lr, float beta_1, float beta_2, float epsilon, float weight_decay, bool decoupled){
+    for (int i = 0; i < p.size(); i++) {
+        double gi = g[i];
+        if (decoupled) p[i] *= 1.0 - lr * weight_decay;
+        else gi += weight_decay * p[i];
+        m[i] = beta_1 * m[i] + (1.0 - beta_1) * gi;
+        v[i] = beta_2 * v[i] + (1.0 - beta_2) * gi * gi;
+        double mc = m[i] / (1.0 - std::pow(beta_1, t));
+        double vc = v[i] / (1.0 - std::pow(beta_2, t));
+        p[i] -= lr * mc / std::sqrt(vc + epsilon);
+    }
+}
+
+static void check_adam(Optimizer *opt, float lr, float weight_decay, bool decoupled){
+    layer in = Input({16});
+    layer d = Dense(in, 8, false);
+    model net = Model({in}, {d});
+    build(net, opt, {"mse"}, {"mse"}, CS_CPU(1));
+
+    Tensor *W = d->params[0];
+    Tensor *gW = d->gradients[0];
+    W->rand_normal(0.0f, 1.0f);
+    vector<double> p(W->ptr, W->ptr + W->size), m(W->size, 0.0), v(W->size, 0.0);
+
+    for (int t = 1; t <= 5; t++) {
+        gW->rand_normal(0.0f, 1.0f);
+        adam_reference(p, m, v, gW->ptr, t, lr, 0.9f, 0.999f, 1e-6f, weight_decay, decoupled);
+        net->optimizer->applygrads(1);
+        for (int i = 0; i < W->size; i++) ASSERT_NEAR(W->ptr[i], p[i], 1e-5);
+    }
+    delete net;
+}
+
+
+TEST(OptimizerTestSuite, adam_reference_update){
+    check_adam(adam(0.01f, 0.9f, 0.999f, 1e-6f, 0.0f), 0.01f, 0.0f, false);
+}
+
+TEST(OptimizerTestSuite, adam_weight_decay_ignored){
+    // As in earlier versions, only AdamW decays the weights
+    check_adam(adam(0.01f, 0.9f, 0.999f, 1e-6f, 0.1f), 0.01f, 0.0f, false);
+}
+
+TEST(OptimizerTestSuite, adamw_decoupled_weight_decay){
+    check_adam(adamw(0.01f, 0.9f, 0.999f, 1e-6f, 0.1f), 0.01f, 0.1f, true);
+}
@@ -88,3 +88,37 @@ TEST(TensorTestSuite, tensor_math_argsort) {
 }
 
 
+
+
+TEST(TensorTestSuite, tensor_permute) {
+    // Test #1: {2,3,4} => (2,0,1)
+    Tensor *t1 = Tensor::zeros({2, 3, 4});
+    for(int i=0; i<t1->size; i++){ t1->ptr[i] = i; }
+
+    Tensor *new_t = Tensor::permute(t1, {2, 0, 1});
+    ASSERT_TRUE(new_t->shape == vector<int>({4, 2, 3}));
+    for(int a=0; a<2; a++)
+        for(int b=0; b<3; b++)
+            for(int c=0; c<4; c++)
+                ASSERT_EQ(new_t->ptr[c*6 + a*3 + b], t1->ptr[a*12 + b*4 + c]);
+
+    // Test #2: tiled transpose (several tiles, borders included)
+    Tensor *t2 = Tensor::randu({70, 45});
+    Tensor *t2_t = Tensor::permute(t2, {1, 0});
+    for(int i=0; i<70; i++)
+        for(int j=0; j<45; j++)
+            ASSERT_EQ(t2_t->ptr[j*70 + i], t2->ptr[i*45 + j]);
+
+    // Test #3: in-place (square batched transpose and general case)
+    Tensor *t3 = Tensor::randu({3, 40, 40});
+    Tensor *t3_ref = Tensor::permute(t3, {0, 2, 1});
+    t3->permute_({0, 2, 1});
+    ASSERT_TRUE(Tensor::equivalent(t3_ref, t3, 10e-6));
+
+    t1->moveaxis_(2, 0);
+    ASSERT_TRUE(Tensor::equivalent(new_t, t1, 10e-6));
+
+    delete t1; delete new_t;
+    delete t2; delete t2_t;
+    delete t3; delete t3_ref;
+}
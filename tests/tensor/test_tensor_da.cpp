@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+#include "eddl/tensor/tensor.h"
+
+
+using namespace std;
+
+
+TEST(TensorTestSuite, tensor_da_affine_random) {
+    Tensor *t1 = Tensor::randu({2, 3, 7, 7});
+    Tensor *t2 = new Tensor(t1->shape);
+
+    // Test #1: identity (nearest and bilinear)
+    Tensor::affine_random(t1, t2, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, -1, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, false);
+    ASSERT_TRUE(Tensor::equivalent(t1, t2, 10e-6));
+    Tensor::affine_random(t1, t2, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, -1, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, true);
+    ASSERT_TRUE(Tensor::equivalent(t1, t2, 10e-6));
+
+    // Test #2: 90 degrees about the center is an exact permutation (same angle convention as rotate_random)
+    Tensor::affine_random(t1, t2, {90.0f, 90.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, -1, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, true);
+    for(int p=0; p<6; p++)
+        for(int i=0; i<7; i++)
+            for(int j=0; j<7; j++)
+                ASSERT_NEAR(t2->ptr[p*49 + i*7 + j], t1->ptr[p*49 + (6-j)*7 + i], 10e-5);
+
+    // Test #3: shift of one pixel with a constant border
+    Tensor::affine_random(t1, t2, {0.0f, 0.0f}, {1.0f, 1.0f}, {1.0f/7.0f, 1.0f/7.0f}, {0.0f, 0.0f}, -1, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, false, WrappingMode::Constant, -1.0f);
+    for(int p=0; p<6; p++)
+        for(int i=0; i<7; i++) {
+            ASSERT_EQ(t2->ptr[p*49 + i*7], -1.0f);
+            for(int j=1; j<7; j++)
+                ASSERT_EQ(t2->ptr[p*49 + i*7 + j], t1->ptr[p*49 + i*7 + j-1]);
+        }
+
+    // Test #4: crop of half the image scaled back, bilinear is exact on a ramp
+    Tensor *r = new Tensor({2, 3, 9, 9});
+    for(int i=0; i<r->size; i++) r->ptr[i] = (float)(i % 81);
+    Tensor *r2 = new Tensor(r->shape);
+    Tensor::affine_random(r, r2, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, -1, {0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f}, true);
+    for(int p=0; p<6; p++)
+        for(int i=0; i<9; i++)
+            for(int j=0; j<9; j++) {
+                float v = r2->ptr[p*81 + i*9 + j];
+                ASSERT_GE(v, 0.0f);
+                ASSERT_LE(v, 80.0f);
+                if (j > 0) ASSERT_NEAR(v - r2->ptr[p*81 + i*9 + j-1], 0.5f, 10e-4);
+                if (i > 0) ASSERT_NEAR(v - r2->ptr[p*81 + (i-1)*9 + j], 4.5f, 10e-4);
+            }
+
+    // Test #5: cutout of 3x3 pixels (the same area in every channel) over the identity
+    Tensor::affine_random(t1, t2, {0.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}, -1, {1.0f, 1.0f}, {0.5f, 0.5f}, {0.5f, 0.5f}, false, WrappingMode::Constant, -1.0f);
+    for(int b=0; b<2; b++) {
+        int cut = 0;
+        for(int c=0; c<3; c++)
+            for(int k=0; k<49; k++) {
+                int p = (b*3 + c)*49 + k;
+                if (t2->ptr[p] == -1.0f) { cut++; ASSERT_EQ(t2->ptr[b*3*49 + k], -1.0f); }
+                else ASSERT_EQ(t2->ptr[p], t1->ptr[p]);
+            }
+        ASSERT_EQ(cut, 3 * 9);
+    }
+
+    delete t1;
+    delete t2;
+    delete r;
+    delete r2;
+}
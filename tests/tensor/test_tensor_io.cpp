@@ -336,4 +336,26 @@ TEST(TensorTestSuite, tensor_io_bin)
     if(hasFailed) { cout << "Error deleting file: " << fname << endl; }
 
     ASSERT_TRUE(Tensor::equivalent(t_iris, t_load, 10e-5));
-}
\ No newline at end of file
+}
+TEST(TensorTestSuite, tensor_io_bin_half)
+{
+    for (string dtype : {"bfloat16", "float16"}) {
+        // Generate random name
+        int rdn_name = dist6(mt);
+        string fname = "iris_" + to_string(rdn_name) + ".bin";
+
+        // Save file with 16-bit values
+        t_iris->save(fname, "bin", dtype);
+
+        // Load saved file (back to float)
+        Tensor* t_load = Tensor::load(fname);
+
+        // Delete file
+        int hasFailed = std::remove(fname.c_str());
+        if(hasFailed) { cout << "Error deleting file: " << fname << endl; }
+
+        // 8 (bfloat16) and 11 (float16) bits of mantissa, values below 8
+        ASSERT_TRUE(Tensor::equivalent(t_iris, t_load, (dtype == "bfloat16") ? 2e-2f : 4e-3f));
+        delete t_load;
+    }
+}
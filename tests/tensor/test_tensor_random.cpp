@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "eddl/tensor/tensor.h"
+#include "eddl/random.h"
+
+
+// Fills of every generator with a fixed seed
+static std::vector<float> random_fills(uint64_t seed){
+    set_random_seed(seed);
+    Tensor *t = Tensor::empty({1001});  // Not a multiple of the blocks of 4
+    std::vector<float> v;
+    t->rand_uniform(1.0f); v.insert(v.end(), t->ptr, t->ptr + t->size);
+    t->rand_signed_uniform(1.0f); v.insert(v.end(), t->ptr, t->ptr + t->size);
+    t->rand_normal(0.0f, 1.0f); v.insert(v.end(), t->ptr, t->ptr + t->size);
+    t->rand_normal(0.0f, 1.0f, false); v.insert(v.end(), t->ptr, t->ptr + t->size);
+    t->rand_binary(0.5f); v.insert(v.end(), t->ptr, t->ptr + t->size);
+    for (int i = 0; i < 10; i++) v.push_back(uniform());
+    delete t;
+    return v;
+}
+
+
+TEST(TensorTestSuite, tensor_random_seed_threads){
+#ifdef _OPENMP
+    int threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    std::vector<float> ref = random_fills(1234);
+
+    // Same seed, same numbers with any number of threads
+    for (int n : {2, 3, 8}) {
+#ifdef _OPENMP
+        omp_set_num_threads(n);
+#endif
+        std::vector<float> v = random_fills(1234);
+        ASSERT_EQ(v.size(), ref.size());
+        ASSERT_EQ(std::memcmp(v.data(), ref.data(), v.size() * sizeof(float)), 0);
+    }
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+#endif
+
+    // Another seed changes them, and setting it again repeats them
+    std::vector<float> other = random_fills(4321);
+    ASSERT_NE(std::memcmp(other.data(), ref.data(), ref.size() * sizeof(float)), 0);
+    ASSERT_EQ(std::memcmp(random_fills(1234).data(), ref.data(), ref.size() * sizeof(float)), 0);
+}
+
+TEST(TensorTestSuite, tensor_random_uniform_blocks){
+    set_random_seed(7);
+    std::vector<float> a;
+    for (int i = 0; i < 1000; i++) {
+        float u = uniform(2.0f, 3.0f);
+        ASSERT_GE(u, 2.0f);
+        ASSERT_LT(u, 3.0f);
+        a.push_back(u);
+    }
+    set_random_seed(7);
+    for (int i = 0; i < 1000; i++) ASSERT_EQ(uniform(2.0f, 3.0f), a[i]);
+
+    // uniform() reserves a block of counters, so a fill after it does not reuse them
+    Tensor *t1 = Tensor::empty({1000});
+    Tensor *t2 = Tensor::empty({1000});
+    set_random_seed(7);
+    t1->rand_uniform(1.0f);
+    set_random_seed(7);
+    uniform();
+    t2->rand_uniform(1.0f);
+    ASSERT_NE(std::memcmp(t1->ptr, t2->ptr, 1000 * sizeof(float)), 0);
+    delete t1;
+    delete t2;
+}
+
+TEST(TensorTestSuite, tensor_random_normal_precision){
+    // Both modes draw the same counters: close values, the exact one in double
+    Tensor *fast = Tensor::empty({100000});
+    Tensor *exact = Tensor::empty({100000});
+    set_random_seed(11);
+    fast->rand_normal(0.0f, 1.0f, true);
+    set_random_seed(11);
+    exact->rand_normal(0.0f, 1.0f, false);
+    ASSERT_NE(std::memcmp(fast->ptr, exact->ptr, fast->size * sizeof(float)), 0);
+
+    double mean = 0.0, var = 0.0;
+    for (int i = 0; i < exact->size; i++) {
+        ASSERT_NEAR(fast->ptr[i], exact->ptr[i], 1e-3f);
+        mean += exact->ptr[i];
+        var += exact->ptr[i] * exact->ptr[i];
+    }
+    mean /= exact->size;
+    var = var / exact->size - mean * mean;
+    ASSERT_NEAR(mean, 0.0, 0.02);
+    ASSERT_NEAR(var, 1.0, 0.02);
+    delete fast;
+    delete exact;
+}
@@ -2,6 +2,7 @@
 #include <random>
 #include <string>
 #include <ctime>
+#include <limits>
 
 #include "eddl/tensor/tensor.h"
 #include "eddl/tensor/tensor_reduction.h"
@@ -472,4 +473,83 @@ TEST(TensorTestSuite, tensor_math_reduction_median) {
 
     ASSERT_TRUE(Tensor::equivalent(t_cpu_median, t_gpu_median, 10e-4));
 #endif
-}
\ No newline at end of file
+}
+
+TEST(TensorTestSuite, tensor_reduction_descriptor) {
+    // {2,2,3}: reduce axis 0 (inner dims kept) and axes 0,2 (inner dim reduced)
+    Tensor *t1 = new Tensor({
+                                    1.0f, 4.0f, 4.0f,
+                                    5.0f, 4.0f, 8.0f,
+
+                                    2.0f, -3.0f, 9.0f,
+                                    1.0f, 6.0f, 0.0f}, {2, 2, 3}, DEV_CPU);
+
+    auto *rd_max = new ReduceDescriptor(t1, {0}, "max", false);
+    reduction(rd_max);
+    Tensor *max_ref = new Tensor({2.0f, 4.0f, 9.0f, 5.0f, 6.0f, 8.0f}, {2, 3}, DEV_CPU);
+    Tensor *arg_ref = new Tensor({6.0f, 1.0f, 8.0f, 3.0f, 10.0f, 5.0f}, {2, 3}, DEV_CPU);
+    ASSERT_TRUE(Tensor::equivalent(max_ref, rd_max->O, 10e-4));
+    ASSERT_TRUE(Tensor::equivalent(arg_ref, rd_max->S, 10e-4));
+
+    auto *rd_mean = new ReduceDescriptor(t1, {0, 2}, "mean", true);
+    reduction(rd_mean);
+    float m0 = 17.0f/6.0f;
+    Tensor *mean_ref = new Tensor({
+                                    m0, m0, m0,
+                                    4.0f, 4.0f, 4.0f,
+
+                                    m0, m0, m0,
+                                    4.0f, 4.0f, 4.0f}, {2, 2, 3}, DEV_CPU);
+    ASSERT_TRUE(Tensor::equivalent(mean_ref, rd_mean->O, 10e-4));
+
+    // Backward: every input gets the mean of the deltas of its group
+    rd_mean->D = Tensor::ones({2, 2, 3});
+    rd_mean->ID = Tensor::zeros({2, 2, 3});
+    reduction_back(rd_mean);
+    ASSERT_TRUE(Tensor::equivalent(Tensor::ones({2, 2, 3}), rd_mean->ID, 10e-4));
+}
+
+TEST(TensorTestSuite, tensor_reduction_max_keepdims_back) {
+    // {2,2,3} reduced over axes 0,2: the group of row 0 and the group of row 1
+    Tensor *t1 = new Tensor({
+                                    1.0f, 4.0f, 4.0f,
+                                    5.0f, 4.0f, 8.0f,
+
+                                    2.0f, -3.0f, 9.0f,
+                                    1.0f, 6.0f, 0.0f}, {2, 2, 3}, DEV_CPU);
+
+    // Every output of a group sends its delta to the max of the group
+    auto *rd = new ReduceDescriptor(t1, {0, 2}, "max", true);
+    reduction(rd);
+    rd->D = Tensor::ones({2, 2, 3});
+    rd->ID = Tensor::zeros({2, 2, 3});
+    reduction_back(rd);
+    Tensor *id_ref = new Tensor({
+                                    0.0f, 0.0f, 0.0f,
+                                    0.0f, 0.0f, 6.0f,
+
+                                    0.0f, 0.0f, 6.0f,
+                                    0.0f, 0.0f, 0.0f}, {2, 2, 3}, DEV_CPU);
+    ASSERT_TRUE(Tensor::equivalent(id_ref, rd->ID, 10e-4));
+
+    // A group of NaNs has no max: its delta goes to its first element
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    Tensor *t2 = new Tensor({
+                                    nan, nan, nan,
+                                    5.0f, 4.0f, 8.0f,
+
+                                    nan, nan, nan,
+                                    1.0f, 6.0f, 0.0f}, {2, 2, 3}, DEV_CPU);
+    auto *rd_nan = new ReduceDescriptor(t2, {0, 2}, "max", true);
+    reduction(rd_nan);
+    rd_nan->D = Tensor::ones({2, 2, 3});
+    rd_nan->ID = Tensor::zeros({2, 2, 3});
+    reduction_back(rd_nan);
+    Tensor *id_nan_ref = new Tensor({
+                                    6.0f, 0.0f, 0.0f,
+                                    0.0f, 0.0f, 6.0f,
+
+                                    0.0f, 0.0f, 0.0f,
+                                    0.0f, 0.0f, 0.0f}, {2, 2, 3}, DEV_CPU);
+    ASSERT_TRUE(Tensor::equivalent(id_nan_ref, rd_nan->ID, 10e-4));
+}